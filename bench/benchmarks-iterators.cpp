@@ -6,6 +6,181 @@
 namespace {
 constexpr std::size_t SizePolicy = 32;
 
+void AnyViewFilter(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    lz::AnyView<int> view = lz::filter(arr, [](const int i) noexcept { return i == 0; });
+
+    for (auto _ : state) {
+        for (int filtered : view) {
+            benchmark::DoNotOptimize(filtered);
+        }
+    }
+}
+
+// Terminal operations pull the elements in batches, one call into the erased iterator per batch
+void AnyViewFilterToVector(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    lz::AnyView<int> view = lz::filter(arr, [](const int i) noexcept { return i == 0; });
+
+    for (auto _ : state) {
+        std::vector<int> vec = view.toVector();
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+// A vector behind an AnyView is copied and searched through pointers
+void AnyViewContiguous(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    lz::AnyView<int> view = arr;
+
+    for (auto _ : state) {
+        std::array<int, SizePolicy> copy{};
+        view.copyTo(copy.begin());
+        benchmark::DoNotOptimize(copy.data());
+        benchmark::DoNotOptimize(lz::contains(view, 1));
+    }
+}
+
+// Every postfix increment, operator+ and view.end() copies an iterator
+void AnyViewIteratorCopies(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    lz::AnyView<int, int&, std::random_access_iterator_tag> view = arr;
+
+    for (auto _ : state) {
+        for (auto it = view.begin(); it != view.end(); it++) {
+            benchmark::DoNotOptimize(*(it + 0));
+        }
+    }
+}
+
+void ConcreteIteratorCopies(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    auto view = lz::chain(arr);
+
+    for (auto _ : state) {
+        for (auto it = view.begin(); it != view.end(); it++) {
+            benchmark::DoNotOptimize(*(it + 0));
+        }
+    }
+}
+
+// Iterators of a pipeline with std::function share the functions of their view, so copying them does not copy the functions
+void PipelineIteratorCopies(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    std::function<bool(int)> predicate = [](const int i) {
+        return i == 0;
+    };
+    std::function<int(int)> function = [](const int i) {
+        return i + 1;
+    };
+    auto view = lz::chain(arr).filter(predicate).map(function).filter(predicate);
+
+    for (auto _ : state) {
+        for (auto it = view.begin(); it != view.end(); it++) {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+}
+
+// A pipeline that is iterated three times, the maps and filters of a cached pipeline are only evaluated in the first pass
+void FilterMapSum(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<int>(i);
+    }
+
+    for (auto _ : state) {
+        auto pipeline = lz::chain(arr).filter([](const int i) { return i % 3 != 0; }).map([](const int i) { return i * i; });
+        benchmark::DoNotOptimize(pipeline.sum());
+    }
+}
+
+// Contiguous arithmetic sequences are summed with multiple accumulators
+void ArithmeticSum(benchmark::State& state) {
+    std::vector<double> vec(static_cast<std::size_t>(state.range(0)), 1.5);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lz::chain(vec).sum());
+        benchmark::DoNotOptimize(lz::chain(vec).mean());
+    }
+}
+
+// Both the min and the max are found in one pass
+void ArithmeticMinMax(benchmark::State& state) {
+    std::vector<int> vec = lz::range(static_cast<int>(state.range(0))).toVector();
+
+    for (auto _ : state) {
+        auto minMax = lz::chain(vec).minMax();
+        benchmark::DoNotOptimize(minMax.first);
+        benchmark::DoNotOptimize(minMax.second);
+    }
+}
+
+void ConcatenateCopy(benchmark::State& state) {
+    std::vector<int> a(SizePolicy / 2, 1);
+    std::vector<int> b(SizePolicy / 2, 2);
+    std::array<int, SizePolicy> copied{};
+
+    for (auto _ : state) {
+        lz::concat(a, b).copyTo(copied.data());
+        benchmark::DoNotOptimize(copied.data());
+    }
+}
+
+void FlattenSum(benchmark::State& state) {
+    std::vector<std::vector<int>> vecs(SizePolicy / 8, std::vector<int>(8, 1));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lz::chain(lz::flatten(vecs)).sum());
+    }
+}
+
+void ChainToVector(benchmark::State& state) {
+    std::vector<int> vec(SizePolicy, 1);
+
+    for (auto _ : state) {
+        std::vector<int> exported = lz::chain(vec).toVector();
+        benchmark::DoNotOptimize(exported.data());
+    }
+}
+
+void CStringToString(benchmark::State& state) {
+    std::string str(SizePolicy, 'a');
+
+    for (auto _ : state) {
+        std::string exported = lz::cString(str.c_str()).to<std::string>();
+        benchmark::DoNotOptimize(exported.data());
+    }
+}
+
+void ConcatenateToVector(benchmark::State& state) {
+    std::vector<int> a(SizePolicy / 2, 1);
+    std::vector<int> b(SizePolicy / 2, 2);
+
+    for (auto _ : state) {
+        std::vector<int> exported = lz::concat(a, b).toVector();
+        benchmark::DoNotOptimize(exported.data());
+    }
+}
+
+void CacheMultiplePasses(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<int>(i);
+    }
+
+    for (auto _ : state) {
+        auto cached = lz::chain(arr)
+                          .map([](const int i) { return std::to_string(i * 1000003); })
+                          .filter([](const std::string& s) { return s.back() != '0'; })
+                          .cache();
+        benchmark::DoNotOptimize(cached.distance());
+        benchmark::DoNotOptimize(cached.max());
+        std::vector<std::string> exported = cached.toVector();
+        benchmark::DoNotOptimize(exported.data());
+    }
+}
+
 void CartesianProduct(benchmark::State& state) {
     std::array<int, SizePolicy / 8> a{};
     std::array<char, SizePolicy / 4> b{};
@@ -86,6 +261,81 @@ void Except(benchmark::State& state) {
     }
 }
 
+// The following except benchmarks take the size of the exclusion set as argument, to show where hashing starts to pay off
+void ExceptSortFirst(benchmark::State& state) {
+    std::vector<int> values = lz::range(4096).toVector();
+    std::vector<int> unsorted = lz::range(static_cast<int>(state.range(0)) * 2, 0, -2).toVector();
+
+    for (auto _ : state) {
+        std::vector<int> toExcept = unsorted;
+        std::sort(toExcept.begin(), toExcept.end());
+        for (int excepted : lz::except(values, toExcept)) {
+            benchmark::DoNotOptimize(excepted);
+        }
+    }
+}
+
+void HashExcept(benchmark::State& state) {
+    std::vector<int> values = lz::range(4096).toVector();
+    std::vector<int> unsorted = lz::range(static_cast<int>(state.range(0)) * 2, 0, -2).toVector();
+
+    for (auto _ : state) {
+        for (int excepted : lz::hashExcept(values, unsorted)) {
+            benchmark::DoNotOptimize(excepted);
+        }
+    }
+}
+
+void ExceptSorted(benchmark::State& state) {
+    std::vector<int> values = lz::range(4096).toVector();
+    std::vector<int> sorted = lz::range(0, static_cast<int>(state.range(0)) * 2, 2).toVector();
+
+    for (auto _ : state) {
+        for (int excepted : lz::except(values, sorted)) {
+            benchmark::DoNotOptimize(excepted);
+        }
+    }
+}
+
+void HashExceptSorted(benchmark::State& state) {
+    std::vector<int> values = lz::range(4096).toVector();
+    std::vector<int> sorted = lz::range(0, static_cast<int>(state.range(0)) * 2, 2).toVector();
+
+    for (auto _ : state) {
+        for (int excepted : lz::hashExcept(values, sorted, lz::sorted)) {
+            benchmark::DoNotOptimize(excepted);
+        }
+    }
+}
+
+// Almost no element is in the exclusion set. Both views are created once, so only the lookups are measured
+void AntiJoin(benchmark::State& state) {
+    std::vector<int> values = lz::random(0, 1 << 30, 4096).toVector();
+    std::vector<int> unsorted = lz::random(0, 1 << 30, static_cast<std::size_t>(state.range(0))).toVector();
+    auto identity = [](int i) noexcept {
+        return i;
+    };
+    auto joined = lz::antiJoin(values, unsorted, identity, identity);
+
+    for (auto _ : state) {
+        for (int excepted : joined) {
+            benchmark::DoNotOptimize(excepted);
+        }
+    }
+}
+
+void HashExceptLookup(benchmark::State& state) {
+    std::vector<int> values = lz::random(0, 1 << 30, 4096).toVector();
+    std::vector<int> unsorted = lz::random(0, 1 << 30, static_cast<std::size_t>(state.range(0))).toVector();
+    auto excepted = lz::hashExcept(values, unsorted);
+
+    for (auto _ : state) {
+        for (int value : excepted) {
+            benchmark::DoNotOptimize(value);
+        }
+    }
+}
+
 void Exclude(benchmark::State& state) {
     std::array<int, SizePolicy> a = lz::range<int>(SizePolicy).toArray<SizePolicy>();
 
@@ -116,6 +366,76 @@ void Filter(benchmark::State& state) {
     }
 }
 
+// The same filter materialized with a lambda, and with a predicate from lz::pred that is evaluated with SIMD instructions
+void FilterLambdaToVector(benchmark::State& state) {
+    std::array<float, SizePolicy * 32> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<float>(i % 100);
+    }
+
+    for (auto _ : state) {
+        std::vector<float> vec = lz::filter(arr, [](const float f) noexcept { return f > 10.f && f < 60.f; }).toVector();
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+void FilterPredicateToVector(benchmark::State& state) {
+    std::array<float, SizePolicy * 32> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<float>(i % 100);
+    }
+
+    for (auto _ : state) {
+        std::vector<float> vec = lz::filter(arr, lz::pred::gt(10.f) && lz::pred::lt(60.f)).toVector();
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+
+// The first match is found when the view is constructed, so asking for begin() again does not search again
+void FilterBeginInLoop(benchmark::State& state) {
+    std::array<int, SizePolicy * 32> arr{};
+    arr.back() = 1;
+    auto filter = lz::filter(arr, [](const int i) noexcept { return i == 1; });
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < SizePolicy; ++i) {
+            benchmark::DoNotOptimize(filter.begin());
+            benchmark::DoNotOptimize(filter.empty());
+        }
+    }
+}
+
+// Adjacent filters of a chain are fused into a single filter that tests both predicates
+void ChainFilterFilter(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+
+    for (auto _ : state) {
+        auto chain = lz::chain(arr)
+                         .filter([](const int i) noexcept { return i >= 0; })
+                         .filter([](const int i) noexcept { return i % 2 == 0; });
+        for (int i : chain) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+
+// A filter of a map keeps the mapped element, so the (expensive) function of the map is called once per element
+void FilterOfMap(benchmark::State& state) {
+    std::array<int, SizePolicy> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<int>(i);
+    }
+
+    for (auto _ : state) {
+        auto strings = lz::chain(arr)
+                           .map([](const int i) { return std::to_string(i * 1000003); })
+                           .filter([](const std::string& s) { return s.back() != '0'; });
+        for (const std::string& s : strings) {
+            benchmark::DoNotOptimize(s.data());
+        }
+    }
+}
+
 void Flatten(benchmark::State& state) {
     std::array<std::array<int, SizePolicy / 4>, SizePolicy / 8> arr{};
     for (auto _ : state) {
@@ -161,6 +481,30 @@ void GroupBy(benchmark::State& state) {
     }
 }
 
+// Per key sums of unsorted keys, the amount of distinct keys is state.range(0)
+void GroupBySortFirst(benchmark::State& state) {
+    std::vector<int> keys = lz::random(0, static_cast<int>(state.range(0)) - 1, 4096).toVector();
+
+    for (auto _ : state) {
+        std::vector<int> sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        for (auto&& group : lz::groupBy(sorted)) {
+            benchmark::DoNotOptimize(std::accumulate(group.second.begin(), group.second.end(), 0));
+        }
+    }
+}
+
+void GroupByAggregate(benchmark::State& state) {
+    std::vector<int> keys = lz::random(0, static_cast<int>(state.range(0)) - 1, 4096).toVector();
+
+    for (auto _ : state) {
+        for (auto&& group : lz::groupByAggregate(
+                 keys, [](int i) noexcept { return i; }, 0, [](int sum, int i) noexcept { return sum + i; })) {
+            benchmark::DoNotOptimize(group.second);
+        }
+    }
+}
+
 void InclusiveScan(benchmark::State& state) {
     auto array = lz::range(SizePolicy).toArray<SizePolicy>();
     auto t = lz::iScan(array);
@@ -211,6 +555,72 @@ void JoinWhere(benchmark::State& state) {
     }
 }
 
+void HashJoinWhere(benchmark::State& state) {
+    std::vector<int> arr = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+    std::vector<int> toJoin = { 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 };
+
+    auto randomIndex = lz::random<std::size_t>(0, toJoin.size() - 1);
+    toJoin[randomIndex.nextRandom()] = arr[randomIndex.nextRandom()]; // Create a value where both values are equal
+    // No sorting needed, includes building the hash table on every iteration
+
+    for (auto _ : state) {
+        for (std::tuple<int, int> val : lz::hashJoinWhere(
+                 arr, toJoin, [](int i) noexcept { return i; }, [](int i) noexcept { return i; },
+                 [](int a, int b) noexcept { return std::make_tuple(a, b); })) {
+            benchmark::DoNotOptimize(val);
+        }
+    }
+}
+
+// The following join benchmarks take the size of both unsorted sides as argument. The sort that joinWhere needs is done on every
+// iteration, like building the hash table is
+void JoinWhereSortFirst(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<int> arr = lz::random(0, static_cast<int>(size) * 2, size).toVector();
+    std::vector<int> unsorted = lz::random(0, static_cast<int>(size) * 2, size).toVector();
+
+    for (auto _ : state) {
+        std::vector<int> toJoin = unsorted;
+        std::sort(toJoin.begin(), toJoin.end());
+        for (std::tuple<int, int> val : lz::joinWhere(
+                 arr, toJoin, [](int i) noexcept { return i; }, [](int i) noexcept { return i; },
+                 [](int a, int b) noexcept { return std::make_tuple(a, b); })) {
+            benchmark::DoNotOptimize(val);
+        }
+    }
+}
+
+void HashJoinWhereUnsorted(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<int> arr = lz::random(0, static_cast<int>(size) * 2, size).toVector();
+    std::vector<int> unsorted = lz::random(0, static_cast<int>(size) * 2, size).toVector();
+
+    for (auto _ : state) {
+        for (std::tuple<int, int> val : lz::hashJoinWhere(
+                 arr, unsorted, [](int i) noexcept { return i; }, [](int i) noexcept { return i; },
+                 [](int a, int b) noexcept { return std::make_tuple(a, b); })) {
+            benchmark::DoNotOptimize(val);
+        }
+    }
+}
+
+void MergeJoinWhere(benchmark::State& state) {
+    std::vector<int> arr = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+    std::vector<int> toJoin = { 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 };
+
+    auto randomIndex = lz::random<std::size_t>(0, toJoin.size() - 1);
+    toJoin[randomIndex.nextRandom()] = arr[randomIndex.nextRandom()]; // Create a value where both values are equal
+    std::sort(toJoin.begin(), toJoin.end());
+
+    for (auto _ : state) {
+        for (std::tuple<int, int> val : lz::mergeJoinWhere(
+                 arr, toJoin, [](int i) noexcept { return i; }, [](int i) noexcept { return i; },
+                 [](int a, int b) noexcept { return std::make_tuple(a, b); })) {
+            benchmark::DoNotOptimize(val);
+        }
+    }
+}
+
 void Map(benchmark::State& state) {
     std::array<int, SizePolicy> arr{};
 
@@ -325,6 +735,29 @@ void Unique(benchmark::State& state) {
     }
 }
 
+// Unsorted ids with duplicates, the amount of distinct ids is state.range(0)
+void UniqueSortFirst(benchmark::State& state) {
+    std::vector<int> ids = lz::random(0, static_cast<int>(state.range(0)) - 1, 4096).toVector();
+
+    for (auto _ : state) {
+        std::vector<int> sorted = ids;
+        std::sort(sorted.begin(), sorted.end());
+        for (int id : lz::unique(sorted)) {
+            benchmark::DoNotOptimize(id);
+        }
+    }
+}
+
+void Distinct(benchmark::State& state) {
+    std::vector<int> ids = lz::random(0, static_cast<int>(state.range(0)) - 1, 4096).toVector();
+
+    for (auto _ : state) {
+        for (int id : lz::distinct(ids)) {
+            benchmark::DoNotOptimize(id);
+        }
+    }
+}
+
 void Zip4(benchmark::State& state) {
     std::array<int, SizePolicy> arrayA{};
     std::array<int, SizePolicy> arrayB{};
@@ -398,6 +831,21 @@ void ZipLongest2(benchmark::State& state) {
 }
 } // namespace
 
+BENCHMARK(AnyViewFilter);
+BENCHMARK(AnyViewFilterToVector);
+BENCHMARK(AnyViewContiguous);
+BENCHMARK(AnyViewIteratorCopies);
+BENCHMARK(ConcreteIteratorCopies);
+BENCHMARK(PipelineIteratorCopies);
+BENCHMARK(FilterMapSum);
+BENCHMARK(ArithmeticSum)->RangeMultiplier(8)->Range(8, 8 << 14);
+BENCHMARK(ArithmeticMinMax)->RangeMultiplier(8)->Range(8, 8 << 14);
+BENCHMARK(ConcatenateCopy);
+BENCHMARK(FlattenSum);
+BENCHMARK(ChainToVector);
+BENCHMARK(CStringToString);
+BENCHMARK(ConcatenateToVector);
+BENCHMARK(CacheMultiplePasses);
 BENCHMARK(CartesianProduct);
 BENCHMARK(ChunkIf);
 BENCHMARK(Chunks);
@@ -405,18 +853,35 @@ BENCHMARK(Concatenate);
 BENCHMARK(CString);
 BENCHMARK(Enumerate);
 BENCHMARK(Except);
+BENCHMARK(ExceptSortFirst)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(HashExcept)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(ExceptSorted)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(HashExceptSorted)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(AntiJoin)->RangeMultiplier(8)->Range(8, 8 << 15);
+BENCHMARK(HashExceptLookup)->RangeMultiplier(8)->Range(8, 8 << 15);
 BENCHMARK(Exclude);
 BENCHMARK(ExclusiveScan);
 BENCHMARK(Filter);
+BENCHMARK(FilterLambdaToVector);
+BENCHMARK(FilterPredicateToVector);
+BENCHMARK(FilterBeginInLoop);
+BENCHMARK(ChainFilterFilter);
+BENCHMARK(FilterOfMap);
 BENCHMARK(Flatten);
 BENCHMARK(DropWhile);
 BENCHMARK(Generate);
 BENCHMARK(GenerateWhile);
 BENCHMARK(GroupBy);
+BENCHMARK(GroupBySortFirst)->RangeMultiplier(8)->Range(4, 4 << 12);
+BENCHMARK(GroupByAggregate)->RangeMultiplier(8)->Range(4, 4 << 12);
 BENCHMARK(InclusiveScan);
 BENCHMARK(JoinInt);
 BENCHMARK(JoinString);
 BENCHMARK(JoinWhere);
+BENCHMARK(HashJoinWhere);
+BENCHMARK(JoinWhereSortFirst)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(HashJoinWhereUnsorted)->RangeMultiplier(8)->Range(8, 8 << 12);
+BENCHMARK(MergeJoinWhere);
 BENCHMARK(Map);
 BENCHMARK(Range);
 BENCHMARK(RegexSplit);
@@ -427,6 +892,8 @@ BENCHMARK(StringSplitter);
 BENCHMARK(TakeWhile);
 BENCHMARK(TakeEvery);
 BENCHMARK(Unique);
+BENCHMARK(UniqueSortFirst)->RangeMultiplier(8)->Range(4, 4 << 12);
+BENCHMARK(Distinct)->RangeMultiplier(8)->Range(4, 4 << 12);
 BENCHMARK(Zip4);
 BENCHMARK(Zip3);
 BENCHMARK(Zip2);
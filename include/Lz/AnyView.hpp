@@ -6,16 +6,15 @@
 #include "Lz/detail/BasicIteratorView.hpp"
 #include "Lz/detail/Procs.hpp"
 #include "Lz/detail/iterators/AnyViewHelpers.hpp"
-#include "Lz/detail/iterators/anyview/AnyIteratorImpl.hpp"
 
 #include <iterator>
-#include <memory>
 
 namespace lz {
 /**
  * @brief Class that can contain any type of view. For example: a container or another view. Use this when you cannot use `auto`.
  * Please be aware that this implementation uses type erasure and therefore is a little bit slower than using `auto`/specifying
- * the "actual" type. For e.g.
+ * the "actual" type. Iterators of at most six pointers in size are stored inline, so copying an `AnyView` iterator does not
+ * allocate; larger iterators are allocated on the heap. For e.g.
  * @code
  * // Preferred:
  * lz::Filter<std::vector<int>::iterator, lambdafunction> f = lz::filter( // stuff...
@@ -36,10 +35,6 @@ private:
     using It = detail::IteratorWrapper<T, Reference, IterCat, DiffType>;
     using Base = detail::BasicIteratorView<It>;
 
-    template<typename View>
-    using AnyIteratorImplType = detail::AnyIteratorImpl<decltype(detail::begin(std::forward<View>(std::declval<View>()))), T,
-                                                        Reference, IterCat, DiffType>;
-
 public:
     AnyView() = default;
     
@@ -50,8 +45,7 @@ public:
      */
     template<class View>
     AnyView(View&& view) :
-        Base(It(std::make_shared<AnyIteratorImplType<View>>(detail::begin(std::forward<View>(view)))),
-             It(std::make_shared<AnyIteratorImplType<View>>(detail::end(std::forward<View>(view))))) {
+        Base(It(detail::begin(std::forward<View>(view))), It(detail::end(std::forward<View>(view)))) {
     }
 };
 } // namespace lz
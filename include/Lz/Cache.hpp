@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef LZ_CACHE_HPP
+#define LZ_CACHE_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/iterators/CacheIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Cache final : public detail::BasicIteratorView<detail::CacheIterator<Iterator>> {
+public:
+    using iterator = detail::CacheIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Buffer = detail::CacheBuffer<Iterator>;
+
+    std::shared_ptr<Buffer> _buffer{};
+
+    explicit Cache(const std::shared_ptr<Buffer>& buffer) :
+        detail::BasicIteratorView<iterator>(iterator(buffer, 0), iterator(buffer, iterator::endIndex())),
+        _buffer(buffer) {
+    }
+
+public:
+    Cache(Iterator begin, Iterator end) : Cache(std::make_shared<Buffer>(std::move(begin), std::move(end))) {
+    }
+
+    Cache() = default;
+
+    /**
+     * Returns the `index`th element, evaluating the sequence up to and including that element if it was not reached yet.
+     * @param index The index of the element. Must be smaller than `size()`.
+     * @return A reference to the element, which stays valid as long as the view exists.
+     */
+    LZ_NODISCARD const value_type& operator[](const std::size_t index) const {
+        // Outside of the assertion, which only checks the result, so that the buffer is filled even if it is compiled out
+        const bool reached = _buffer->reach(index);
+        static_cast<void>(reached);
+        LZ_ASSERT(reached, "index out of bounds");
+        return (*_buffer)[index];
+    }
+
+    /**
+     * Returns the amount of elements, evaluating the rest of the sequence if it was not completely reached yet.
+     * @return The amount of elements in the sequence.
+     */
+    LZ_NODISCARD std::size_t size() const {
+        return _buffer->fill();
+    }
+
+    /**
+     * Evaluates the rest of the sequence if it was not completely reached yet, and returns a random access view over all of its
+     * elements, which are read from the buffer of this view. Contrary to this view, the returned view can be split using
+     * `partition` and is split by parallel algorithms, such as `lz::parallelReduce`.
+     * @return A random access view over the elements, of which the references stay valid as long as the buffer exists.
+     */
+    LZ_NODISCARD detail::BasicIteratorView<detail::FilledCacheIterator<Iterator>> filled() const {
+        const std::size_t size = _buffer->fill();
+        return { detail::FilledCacheIterator<Iterator>(_buffer, 0), detail::FilledCacheIterator<Iterator>(_buffer, size) };
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Evaluates [begin, end) at most once. The first time an element is reached, by any iterator of the view, it is copied
+ * into a buffer that is owned by the view. Every later pass (or copy of an iterator) reads the elements from this buffer, so a
+ * pipeline that is iterated multiple times (e.g. to count, then to find the minimum, then to export) calls its functions only
+ * once per element. The buffer grows in chunks of a fixed size, so references to the elements stay valid. The view can be indexed
+ * with `operator[]`, which only evaluates the sequence as far as needed. `filled()` returns a random access view of all elements.
+ * @attention Iterators of the same view may not be used by multiple threads at once, as they fill the same buffer. Once the whole
+ * sequence is buffered (e.g. after `size()` or `filled()`), the buffer is only read, and the view and the view returned by
+ * `filled()` may be iterated by multiple threads at once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A Cache iterator view object, which can be used to iterate over in a `(for ... : cacheRange(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Cache<Iterator> cacheRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * @brief Evaluates `iterable` at most once. The first time an element is reached, by any iterator of the view, it is copied into
+ * a buffer that is owned by the view. Every later pass (or copy of an iterator) reads the elements from this buffer, so a
+ * pipeline that is iterated multiple times (e.g. to count, then to find the minimum, then to export) calls its functions only
+ * once per element. The buffer grows in chunks of a fixed size, so references to the elements stay valid. The view can be indexed
+ * with `operator[]`, which only evaluates the sequence as far as needed. Use `filled()` for a random access view over all
+ * elements.
+ * @attention Iterators of the same view may not be used by multiple threads at once, as they fill the same buffer. Once the whole
+ * sequence is buffered (e.g. after `size()` or `filled()`), the buffer is only read, and the view and the view returned by
+ * `filled()` may be iterated by multiple threads at once.
+ * @param iterable The iterable sequence.
+ * @return A Cache iterator view object, which can be used to iterate over in a `(for ... : cache(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Cache<detail::IterTypeFromIterable<Iterable>> cache(Iterable&& iterable) {
+    return cacheRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // end namespace lz
+
+#endif // end LZ_CACHE_HPP
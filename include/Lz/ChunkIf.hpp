@@ -26,12 +26,13 @@ public:
     constexpr ChunkIf() = default;
 
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 ChunkIf(Iterator begin, Iterator end, UnaryPredicate predicate, Execution execution) :
+    LZ_CONSTEXPR_CXX_20
+    ChunkIf(Iterator begin, Iterator end, detail::FunctionStorage<UnaryPredicate> predicate, Execution execution) :
         detail::BasicIteratorView<iterator>(iterator(begin, begin, end, predicate, execution),
                                             iterator(end, begin, end, predicate, execution)) {
     }
 #else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
-    ChunkIf(Iterator begin, Iterator end, UnaryPredicate predicate) :
+    ChunkIf(Iterator begin, Iterator end, detail::FunctionStorage<UnaryPredicate> predicate) :
         detail::BasicIteratorView<iterator>(iterator(begin, begin, end, predicate), iterator(end, begin, end, predicate)) {
     }
 #endif // LZ_HAS_EXECUTION
@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef LZ_DISTINCT_HPP
+#define LZ_DISTINCT_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/iterators/DistinctIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector, class Hash, class KeyEqual>
+class Distinct final : public detail::BasicIteratorView<detail::DistinctIterator<Iterator, KeySelector, Hash, KeyEqual>> {
+public:
+    using iterator = detail::DistinctIterator<Iterator, KeySelector, Hash, KeyEqual>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using State = typename iterator::State;
+
+    Distinct(Iterator begin, Iterator end, const std::shared_ptr<State>& state,
+             detail::FunctionStorage<KeySelector> keySelector) :
+        detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, state, keySelector),
+                                            iterator(end, end, state, keySelector)) {
+    }
+
+public:
+    Distinct(Iterator begin, Iterator end, KeySelector keySelector, Hash hash, KeyEqual keyEqual) :
+        Distinct(std::move(begin), std::move(end), std::make_shared<State>(std::move(hash), std::move(keyEqual)),
+                 std::move(keySelector)) {
+    }
+
+    constexpr Distinct() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns the first occurrence of every element in [begin, end), in a single pass. Contrary to `uniqueRange`, [begin, end)
+ * does not need to be sorted. The elements that were seen are kept in a hash set that is owned by the view and shared by all of
+ * its iterators, so iterating the view a second time does not hash the elements again.
+ * @attention Iterators of the same view may not be used by multiple threads at once, as they update the same set.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param hash (Optional) the hash function of the elements. `std::hash` is default.
+ * @param keyEqual (Optional) compares two elements for equality. `operator==` is default.
+ * @return A Distinct iterator view object, which can be used to iterate over in a `(for ... : distinctRange(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Hash = std::hash<detail::ValueType<Iterator>>,
+         class KeyEqual = MAKE_BIN_OP(std::equal_to, detail::ValueType<Iterator>)>
+LZ_NODISCARD Distinct<Iterator, detail::IdentityKey, Hash, KeyEqual>
+distinctRange(Iterator begin, Iterator end, Hash hash = {}, KeyEqual keyEqual = {}) {
+    return { std::move(begin), std::move(end), detail::IdentityKey{}, std::move(hash), std::move(keyEqual) };
+}
+
+/**
+ * @brief Returns the first occurrence of every element in `iterable`, in a single pass. Contrary to `unique`, `iterable` does not
+ * need to be sorted. The elements that were seen are kept in a hash set that is owned by the view and shared by all of its
+ * iterators, so iterating the view a second time does not hash the elements again.
+ * @attention Iterators of the same view may not be used by multiple threads at once, as they update the same set.
+ * @param iterable The iterable sequence.
+ * @param hash (Optional) the hash function of the elements. `std::hash` is default.
+ * @param keyEqual (Optional) compares two elements for equality. `operator==` is default.
+ * @return A Distinct iterator view object, which can be used to iterate over in a `(for ... : distinct(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Hash = std::hash<detail::ValueTypeIterable<Iterable>>,
+         class KeyEqual = MAKE_BIN_OP(std::equal_to, detail::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD Distinct<detail::IterTypeFromIterable<Iterable>, detail::IdentityKey, Hash, KeyEqual>
+distinct(Iterable&& iterable, Hash hash = {}, KeyEqual keyEqual = {}) {
+    return distinctRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                         std::move(hash), std::move(keyEqual));
+}
+
+/**
+ * @brief Returns the first element of `iterable` for every distinct key, in a single pass. The key of an element is the result
+ * of `keySelector`. The keys that were seen are kept in a hash set that is owned by the view and shared by all of its iterators.
+ * @attention Iterators of the same view may not be used by multiple threads at once, as they update the same set.
+ * @param iterable The iterable sequence.
+ * @param keySelector Returns the key of an element, e.g. `[](const Customer& c) { return c.id; }`.
+ * @param hash (Optional) the hash function of the keys. `std::hash` is default.
+ * @param keyEqual (Optional) compares two keys for equality. `operator==` is default.
+ * @return A Distinct iterator view object, which can be used to iterate over in a `(for ... : distinctBy(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Key =
+             detail::Decay<detail::FunctionReturnType<KeySelector, detail::RefType<detail::IterTypeFromIterable<Iterable>>>>,
+         class Hash = std::hash<Key>, class KeyEqual = MAKE_BIN_OP(std::equal_to, Key)>
+LZ_NODISCARD Distinct<detail::IterTypeFromIterable<Iterable>, KeySelector, Hash, KeyEqual>
+distinctBy(Iterable&& iterable, KeySelector keySelector, Hash hash = {}, KeyEqual keyEqual = {}) {
+    return { detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+             std::move(keySelector), std::move(hash), std::move(keyEqual) };
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // end namespace lz
+
+#endif // end LZ_DISTINCT_HPP
@@ -50,7 +50,9 @@ enumerateRange(Iterator begin, Iterator end, const Arithmetic start = 0) {
 #ifndef LZ_HAS_CONCEPTS
     static_assert(std::is_arithmetic<Arithmetic>::value, "the template parameter Arithmetic is meant for arithmetics only");
 #endif
-    return { std::move(begin), std::move(end), detail::sizeHint(begin, end), start };
+    // The index of the end iterator is only needed to decrement it, so it is only set if the size is known exactly
+    const detail::SizeHint hint = detail::getSizeHint(begin, end);
+    return { std::move(begin), std::move(end), static_cast<detail::DiffType<Iterator>>(hint.isExact() ? hint.size : 0), start };
 }
 
 /**
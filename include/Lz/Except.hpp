@@ -5,6 +5,7 @@
 
 #include "detail/BasicIteratorView.hpp"
 #include "detail/iterators/ExceptIterator.hpp"
+#include "detail/iterators/HashExceptIterator.hpp"
 
 namespace lz {
 
@@ -28,12 +29,13 @@ public:
 
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20 Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
-                               Comparer comparer, Execution execPolicy) :
+                               detail::FunctionStorage<Comparer> comparer, Execution execPolicy) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, toExceptBegin, toExceptEnd, comparer, execPolicy),
                                             iterator(end, end, toExceptBegin, toExceptEnd, comparer, execPolicy)) {
     }
 #else  // ^^^ has execution vvv ! has execution
-    Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Comparer comparer) :
+    Except(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+           detail::FunctionStorage<Comparer> comparer) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, std::move(toExceptBegin), toExceptEnd, comparer),
                                             iterator(end, end, toExceptEnd, toExceptEnd, comparer)) {
     }
@@ -42,6 +44,62 @@ public:
     constexpr Except() = default;
 };
 
+// Tells `hashExcept` that both sequences are sorted, so that they can be merged instead of hashing the sequence to except
+struct SortedTag {};
+
+#ifdef LZ_HAS_CXX_17
+inline constexpr SortedTag sorted{};
+#else
+constexpr SortedTag sorted{};
+#endif // LZ_HAS_CXX_17
+
+#ifdef LZ_HAS_EXECUTION
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept, class Execution>
+#else
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept>
+#endif
+class HashExcept final : public detail::BasicIteratorView<detail::HashExceptIterator<Iterator, IteratorToExcept>> {
+public:
+    using iterator = detail::HashExceptIterator<Iterator, IteratorToExcept>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Set = typename iterator::Set;
+
+    static std::shared_ptr<const Set> makeSet(const IteratorToExcept& toExceptBegin, const IteratorToExcept& toExceptEnd) {
+        return std::make_shared<const Set>(toExceptBegin, toExceptEnd,
+                                           detail::reserveSize(detail::getSizeHint(toExceptBegin, toExceptEnd)));
+    }
+
+    HashExcept(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+               const std::shared_ptr<const Set>& set) :
+        detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, toExceptBegin, toExceptEnd, set),
+                                            iterator(end, end, toExceptBegin, toExceptEnd, set)) {
+    }
+
+public:
+#ifdef LZ_HAS_EXECUTION
+    HashExcept(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Execution) :
+        HashExcept(begin, end, toExceptBegin, toExceptEnd, makeSet(toExceptBegin, toExceptEnd)) {
+    }
+
+    HashExcept(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, SortedTag, Execution) :
+        HashExcept(std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd), nullptr) {
+    }
+#else  // ^^^ has execution vvv ! has execution
+    HashExcept(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd) :
+        HashExcept(begin, end, toExceptBegin, toExceptEnd, makeSet(toExceptBegin, toExceptEnd)) {
+    }
+
+    HashExcept(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, SortedTag) :
+        HashExcept(std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd), nullptr) {
+    }
+#endif // LZ_HAS_EXECUTION
+
+    constexpr HashExcept() = default;
+};
+
 /**
  * @addtogroup ItFns
  * @{
@@ -52,7 +110,8 @@ public:
  * @brief Skips elements in [begin, end) that is contained by [toExceptBegin, toExceptEnd). [toExceptBegin, toExceptEnd) must be
  * sorted manually before creating this view.
  * @attention [toExceptBegin, toExceptEnd) must be sorted  manually before creating this view.
- * @param execPolicy The std::execution::* policy.
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
  * @param begin The beginning of the sequence to skip elements in.
  * @param end The ending of the sequence to skip elements in.
  * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
@@ -73,7 +132,8 @@ exceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, Iterat
 /**
  * @brief Skips elements iterable that is contained by toExcept. ToExcept must be sorted manually before creating this view.
  * @attention ToExcept must be sorted manually before creating this view.
- * @param execPolicy The std::execution::* policy.
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
  * @param iterable Sequence to iterate over.
  * @param toExcept Sequence that contains items that must be skipped in `iterable`.
  * @param comparer Comparer for binary search (operator < is default) in IterableToExcept
@@ -89,6 +149,85 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20
                        detail::end(std::forward<IterableToExcept>(toExcept)), std::move(comparer), execPolicy);
 }
 
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd). Contrary to `exceptRange`,
+ * [toExceptBegin, toExceptEnd) does not need to be sorted: a hash set of its elements is built once when the view is created and
+ * is shared by all of its iterators, after which every element is looked up in O(1). If both ranges are sorted, pass `lz::sorted`
+ * to merge them instead.
+ * @attention The value type of IteratorToExcept must be hashable by `std::hash`.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
+ * @return A HashExcept view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashExcept<Iterator, IteratorToExcept, Execution>
+hashExceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                Execution execPolicy = std::execution::seq) {
+    return { std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd), execPolicy };
+}
+
+/**
+ * @brief Skips elements of iterable that are contained by toExcept. Contrary to `except`, toExcept does not need to be sorted: a
+ * hash set of its elements is built once when the view is created and is shared by all of its iterators, after which every
+ * element is looked up in O(1). If both iterables are sorted, pass `lz::sorted` to merge them instead.
+ * @attention The value type of IterableToExcept must be hashable by `std::hash`.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
+ * @return A HashExcept view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE IterableToExcept, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashExcept<detail::IterTypeFromIterable<Iterable>, detail::IterTypeFromIterable<IterableToExcept>, Execution>
+hashExcept(Iterable&& iterable, IterableToExcept&& toExcept, Execution execPolicy = std::execution::seq) {
+    return hashExceptRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                           detail::begin(std::forward<IterableToExcept>(toExcept)),
+                           detail::end(std::forward<IterableToExcept>(toExcept)), execPolicy);
+}
+
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd), where both ranges are sorted. No hash
+ * set is built: both ranges are merged in a single pass, in which [toExceptBegin, toExceptEnd) is only traversed forward.
+ * @attention Both ranges must be sorted using `operator<` manually before creating this view. This is not checked.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param tag `lz::sorted`.
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
+ * @return A HashExcept view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashExcept<Iterator, IteratorToExcept, Execution>
+hashExceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, const SortedTag tag,
+                Execution execPolicy = std::execution::seq) {
+    return { std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd), tag, execPolicy };
+}
+
+/**
+ * @brief Skips elements of iterable that are contained by toExcept, where both iterables are sorted. No hash set is built: both
+ * are merged in a single pass, in which toExcept is only traversed forward.
+ * @attention Both iterables must be sorted using `operator<` manually before creating this view. This is not checked.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param tag `lz::sorted`.
+ * @param execPolicy The std::execution::* policy. The find itself is sequential; pass the policy to the terminal operation
+ * instead.
+ * @return A HashExcept view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE IterableToExcept, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashExcept<detail::IterTypeFromIterable<Iterable>, detail::IterTypeFromIterable<IterableToExcept>, Execution>
+hashExcept(Iterable&& iterable, IterableToExcept&& toExcept, const SortedTag tag, Execution execPolicy = std::execution::seq) {
+    return hashExceptRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                           detail::begin(std::forward<IterableToExcept>(toExcept)),
+                           detail::end(std::forward<IterableToExcept>(toExcept)), tag, execPolicy);
+}
+
 #else // ^^^ has execution vvv ! has execution
 /**
  * @brief Skips elements in [begin, end) that is contained by [toExceptBegin, toExceptEnd). [toExceptBegin, toExceptEnd) must be
@@ -130,6 +269,75 @@ except(Iterable&& iterable, IterableToExcept&& toExcept, Comparer comparer = {})
                        detail::begin(std::forward<IterableToExcept>(toExcept)),
                        detail::end(std::forward<IterableToExcept>(toExcept)), std::move(comparer));
 }
+
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd). Contrary to `exceptRange`,
+ * [toExceptBegin, toExceptEnd) does not need to be sorted: a hash set of its elements is built once when the view is created and
+ * is shared by all of its iterators, after which every element is looked up in O(1). If both ranges are sorted, pass `lz::sorted`
+ * to merge them instead.
+ * @attention The value type of IteratorToExcept must be hashable by `std::hash`.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @return A HashExcept view object.
+ */
+template<class Iterator, class IteratorToExcept>
+HashExcept<Iterator, IteratorToExcept>
+hashExceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd) {
+    return { std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd) };
+}
+
+/**
+ * @brief Skips elements of iterable that are contained by toExcept. Contrary to `except`, toExcept does not need to be sorted: a
+ * hash set of its elements is built once when the view is created and is shared by all of its iterators, after which every
+ * element is looked up in O(1). If both iterables are sorted, pass `lz::sorted` to merge them instead.
+ * @attention The value type of IterableToExcept must be hashable by `std::hash`.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @return A HashExcept view object.
+ */
+template<class Iterable, class IterableToExcept>
+HashExcept<detail::IterTypeFromIterable<Iterable>, detail::IterTypeFromIterable<IterableToExcept>>
+hashExcept(Iterable&& iterable, IterableToExcept&& toExcept) {
+    return hashExceptRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                           detail::begin(std::forward<IterableToExcept>(toExcept)),
+                           detail::end(std::forward<IterableToExcept>(toExcept)));
+}
+
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd), where both ranges are sorted. No hash
+ * set is built: both ranges are merged in a single pass, in which [toExceptBegin, toExceptEnd) is only traversed forward.
+ * @attention Both ranges must be sorted using `operator<` manually before creating this view. This is not checked.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param tag `lz::sorted`.
+ * @return A HashExcept view object.
+ */
+template<class Iterator, class IteratorToExcept>
+HashExcept<Iterator, IteratorToExcept>
+hashExceptRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, const SortedTag tag) {
+    return { std::move(begin), std::move(end), std::move(toExceptBegin), std::move(toExceptEnd), tag };
+}
+
+/**
+ * @brief Skips elements of iterable that are contained by toExcept, where both iterables are sorted. No hash set is built: both
+ * are merged in a single pass, in which toExcept is only traversed forward.
+ * @attention Both iterables must be sorted using `operator<` manually before creating this view. This is not checked.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param tag `lz::sorted`.
+ * @return A HashExcept view object.
+ */
+template<class Iterable, class IterableToExcept>
+HashExcept<detail::IterTypeFromIterable<Iterable>, detail::IterTypeFromIterable<IterableToExcept>>
+hashExcept(Iterable&& iterable, IterableToExcept&& toExcept, const SortedTag tag) {
+    return hashExceptRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                           detail::begin(std::forward<IterableToExcept>(toExcept)),
+                           detail::end(std::forward<IterableToExcept>(toExcept)), tag);
+}
 #endif // LZ_HAS_EXECUTION
 
 // End of group
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef LZ_EXECUTION_HPP
+#define LZ_EXECUTION_HPP
+
+#include "detail/CompilerChecks.hpp"
+#include "detail/ThreadPool.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace lz {
+namespace execution {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * An execution policy that runs parallel operations on a thread pool of this library, instead of on the scheduler of the
+ * standard library (which, depending on the standard library, needs an extra dependency or silently runs sequentially). It is
+ * accepted by every function that accepts a `std::execution` policy. The sequence is split in chunks, which are handed out to the
+ * threads of the pool; sequences that cannot be split (e.g. a `lz::generate`) are processed by the calling thread. Create one
+ * using `lz::execution::pool`.
+ *
+ * The pool does not need `<execution>`, and is also available in C++11 and C++14. Without `<execution>`, terminal operations
+ * do not take an execution policy, but `lz::parallelReduce` does, and views can still be split using `partition`/`split`.
+ */
+class PoolPolicy {
+    std::shared_ptr<detail::ThreadPool> _pool{};
+    std::size_t _chunks{ 0 };
+
+public:
+    PoolPolicy() = default;
+
+    explicit PoolPolicy(std::shared_ptr<detail::ThreadPool> pool) noexcept : _pool(std::move(pool)) {
+    }
+
+    /**
+     * Returns a copy of this policy that splits every sequence in exactly `count` chunks. Chunk results are always combined in
+     * the order of the chunks, so with a fixed amount of chunks, the result of e.g. a floating point `foldl` does not depend on
+     * the amount of threads, or on which thread handled which chunk. By default, a sequence is split in four chunks per thread.
+     * @param count The amount of chunks. 0 is treated as 1.
+     * @return The new policy, which uses the same pool.
+     */
+    LZ_NODISCARD PoolPolicy chunks(const std::size_t count) const {
+        PoolPolicy policy(*this);
+        policy._chunks = count == 0 ? 1 : count;
+        return policy;
+    }
+
+    LZ_NODISCARD detail::ThreadPool& threadPool() const {
+        return _pool ? *_pool : detail::defaultPool();
+    }
+
+    LZ_NODISCARD std::size_t chunkCount() const {
+        return _chunks != 0 ? _chunks : threadPool().threadCount() * 4;
+    }
+};
+
+/**
+ * @brief Creates an execution policy with its own pool, in which `threads` threads work on every operation: the calling thread
+ * and `threads - 1` workers. The pool is shared by all copies of the policy, and its workers are stopped when the last copy is
+ * destroyed.
+ * @param threads The amount of threads, including the calling thread. `pool(1)` runs every operation on the calling thread.
+ * @return The policy, which can be passed to every function that accepts a `std::execution` policy.
+ */
+LZ_NODISCARD inline PoolPolicy pool(const std::size_t threads) {
+    return PoolPolicy(std::make_shared<detail::ThreadPool>(threads));
+}
+
+/**
+ * @brief Returns an execution policy that uses the global pool, which has one thread per hardware thread. The global pool is
+ * created on first use and is never destroyed, so it can safely be used during static destruction.
+ * @return The policy, which can be passed to every function that accepts a `std::execution` policy.
+ */
+LZ_NODISCARD inline PoolPolicy pool() noexcept {
+    return PoolPolicy();
+}
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace execution
+} // namespace lz
+
+#endif // LZ_EXECUTION_HPP
@@ -16,7 +16,9 @@ class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Ite
 public:
     using iterator = detail::FilterIterator<Iterator, UnaryPredicate, Execution>;
 
-    LZ_CONSTEXPR_CXX_20 Filter(Iterator begin, Iterator end, UnaryPredicate function, Execution execution) :
+    // The first match is searched for once, here. `begin()` returns a copy of it, so calling it again is O(1)
+    LZ_CONSTEXPR_CXX_20
+    Filter(Iterator begin, Iterator end, detail::FunctionStorage<UnaryPredicate> function, Execution execution) :
         detail::BasicIteratorView<iterator>(iterator(begin, begin, end, function, execution),
                                             iterator(end, begin, end, function, execution)) {
     }
@@ -26,7 +28,8 @@ class Filter final : public detail::BasicIteratorView<detail::FilterIterator<Ite
 public:
     using iterator = detail::FilterIterator<Iterator, UnaryPredicate>;
 
-    Filter(Iterator begin, Iterator end, UnaryPredicate function) :
+    // The first match is searched for once, here. `begin()` returns a copy of it, so calling it again is O(1)
+    Filter(Iterator begin, Iterator end, detail::FunctionStorage<UnaryPredicate> function) :
         detail::BasicIteratorView<iterator>(iterator(begin, begin, end, function), iterator(end, begin, end, function)) {
     }
 #endif
@@ -50,7 +53,8 @@ public:
  * @param begin The beginning of the range.
  * @param end The ending of the range.
  * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
- * @param execution The execution policy. Must be one of `std::execution`'s tags. Performs the find using this execution.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags. Only checked for compatibility; the
+ * find itself is sequential. Pass the policy to the terminal operation instead (e.g. `to<std::vector>(std::execution::par)`).
  * @return A filter object from [begin, end) that can be converted to an arbitrary container or can be iterated
  * over.
  */
@@ -11,6 +11,7 @@
 #include "Take.hpp"
 #include "TakeWhile.hpp"
 #include "Zip.hpp"
+#include "detail/ArithmeticKernels.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -358,6 +359,51 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<detail::IterTypeFromIterable<Iterable>, det
     return lz::keys(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)));
 }
 
+/**
+ * Reduces a sequence in parallel, without requiring `accumulate` or `combine` to be commutative. The sequence is split in parts
+ * (see `BasicIteratorView::partition`). Every part is folded in order using `accumulate(std::move(partial), element)`, starting
+ * from a copy of `identity`, after which the results of the parts are merged in order using `combine(std::move(left),
+ * std::move(right))`. This makes it possible to e.g. accumulate into a histogram per part and merge the histograms afterwards,
+ * without a lock. Sequences that cannot be split, and sequenced policies, are folded on the calling thread, without `combine`.
+ * @example `lz::parallelReduce(words, Map{}, [](Map m, auto& w) { ++m[w]; return m; }, mergeMaps)`
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param identity The initial value of every part. Must be the identity of `combine`: `combine(identity, x) == x`.
+ * @param accumulate The function that adds an element to the result of a part.
+ * @param combine The function that merges the results of two adjacent parts. Must be associative.
+ * @param execution The execution policy, the global thread pool by default. With `lz::execution::pool(n).chunks(c)` the
+ * result does not depend on the amount of threads. A `std::execution` policy is only accepted if `<execution>` is available.
+ * @return The reduced result.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class T, class Accumulate, class Combine, class Execution = execution::PoolPolicy>
+LZ_NODISCARD detail::EnableIf<!detail::HasBeginFunc<Iterator>::value, T>
+parallelReduce(const Iterator& begin, const Iterator& end, T identity, Accumulate accumulate, Combine combine,
+               Execution execution = execution::pool()) {
+#ifdef LZ_HAS_EXECUTION
+    static_cast<void>(detail::isCompatibleForExecution<Execution, Iterator>());
+#else
+    static_assert(detail::IsPoolPolicy<Execution>::value, "Execution must be of type lz::execution::PoolPolicy");
+#endif // LZ_HAS_EXECUTION
+    return detail::reduceParts(execution, begin, end, std::move(identity), std::move(accumulate), std::move(combine));
+}
+
+/**
+ * Reduces a sequence in parallel, without requiring `accumulate` or `combine` to be commutative. See the iterator overload.
+ * @param iterable The sequence to reduce.
+ * @param identity The initial value of every part. Must be the identity of `combine`: `combine(identity, x) == x`.
+ * @param accumulate The function that adds an element to the result of a part.
+ * @param combine The function that merges the results of two adjacent parts. Must be associative.
+ * @param execution The execution policy, the global thread pool by default.
+ * @return The reduced result.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Accumulate, class Combine, class Execution = execution::PoolPolicy>
+LZ_NODISCARD detail::EnableIf<detail::HasBeginFunc<Iterable>::value, T>
+parallelReduce(const Iterable& iterable, T identity, Accumulate accumulate, Combine combine,
+               Execution execution = execution::pool()) {
+    return lz::parallelReduce(std::begin(iterable), std::end(iterable), std::move(identity), std::move(accumulate),
+                              std::move(combine), execution);
+}
+
 #ifdef LZ_HAS_EXECUTION
 /**
  * Gets the mean of a sequence.
@@ -365,22 +411,23 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<detail::IterTypeFromIterable<Iterable>, det
  * @param end The ending of the sequence.
  * @param binOp The (optional) function to add each value
  * @param execution The execution policy.
- * @note Uses std::distance to get the size of the iterator.
+ * @note Uses std::distance to get the size of the iterator. If the sequence is contiguous memory of arithmetic values of at least
+ * the size of an `int` (or an `lz::as` of those) and `binOp` is the default, the sum is computed in `double` (a 64 bit integer
+ * for integers) with multiple accumulators, so it does not overflow the value type.
  * @return The mean of the sequence.
  */
 template<LZ_CONCEPT_ITERATOR Iterator, class BinaryOp = std::plus<>, class Execution = std::execution::sequenced_policy>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 double
 mean(const Iterator& begin, const Iterator& end, BinaryOp binaryOp = {}, Execution execution = std::execution::seq) {
     using ValueType = detail::ValueType<Iterator>;
-    ValueType sum;
     if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
         static_cast<void>(execution);
-        sum = std::reduce(begin, end, ValueType{ 0 }, std::move(binaryOp));
+        return detail::mean(begin, end, std::move(binaryOp));
     }
     else {
-        sum = std::reduce(execution, begin, end, ValueType{ 0 }, std::move(binaryOp));
+        const ValueType sum = detail::executeReduce(execution, begin, end, ValueType{ 0 }, std::move(binaryOp));
+        return static_cast<double>(sum) / static_cast<double>(static_cast<std::size_t>(std::distance(begin, end)));
     }
-    return static_cast<double>(sum) / static_cast<double>(static_cast<std::size_t>(std::distance(begin, end)));
 }
 
 /**
@@ -568,7 +615,7 @@ median(const Iterator& begin, const Iterator& end, Comparer comparer = {}, Execu
         std::nth_element(begin, midIter, end, comparer);
     }
     else {
-        std::nth_element(execution, begin, midIter, end, comparer);
+        detail::executeNthElement(execution, begin, midIter, end, comparer);
     }
     if (detail::isEven(len)) {
         if constexpr (isSequenced) {
@@ -576,7 +623,7 @@ median(const Iterator& begin, const Iterator& end, Comparer comparer = {}, Execu
             return (static_cast<double>(*leftHalf) + *midIter) / 2.;
         }
         else {
-            const Iterator leftHalf = std::max_element(execution, begin, midIter, comparer);
+            const Iterator leftHalf = detail::executeMaxElement(execution, begin, midIter, comparer);
             return (static_cast<double>(*leftHalf) + *midIter) / 2.;
         }
     }
@@ -616,7 +663,7 @@ findFirstOrDefault(Iterator begin, Iterator end, const T& toFind, const U& defau
         return static_cast<ValueType>(std::find(std::move(begin), end, toFind) == end ? defaultValue : toFind);
     }
     else {
-        return static_cast<ValueType>(std::find(execution, std::move(begin), end, toFind) == end ? defaultValue : toFind);
+        return static_cast<ValueType>(detail::executeFind(execution, begin, end, toFind) == end ? defaultValue : toFind);
     }
 }
 
@@ -656,7 +703,7 @@ findFirstOrDefaultIf(Iterator begin, Iterator end, UnaryPredicate predicate, con
         return static_cast<ValueType>(pos == end ? defaultValue : *pos);
     }
     else {
-        const Iterator pos = std::find_if(execution, std::move(begin), end, std::move(predicate));
+        const Iterator pos = detail::executeFindIf(execution, begin, end, std::move(predicate));
         return static_cast<ValueType>(pos == end ? defaultValue : *pos);
     }
 }
@@ -764,7 +811,7 @@ indexOf(Iterator begin, Iterator end, const T& val, Execution execution = std::e
         return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
     }
     else {
-        const Iterator pos = std::find(execution, begin, end, val);
+        const Iterator pos = detail::executeFind(execution, begin, end, val);
         return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
     }
 }
@@ -802,7 +849,7 @@ indexOfIf(Iterator begin, Iterator end, UnaryFunc predicate, Execution execution
         return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
     }
     else {
-        const Iterator pos = std::find_if(execution, begin, end, std::move(predicate));
+        const Iterator pos = detail::executeFindIf(execution, begin, end, std::move(predicate));
         return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
     }
 }
@@ -833,10 +880,10 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool
 contains(Iterator begin, Iterator end, const T& value, Execution execution = std::execution::seq) {
     if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
         static_cast<void>(execution);
-        return std::find(std::move(begin), end, value) != end;
+        return detail::contains(std::move(begin), end, value);
     }
     else {
-        return std::find(execution, std::move(begin), end, value) != end;
+        return detail::executeFind(execution, begin, end, value) != end;
     }
 }
 
@@ -869,7 +916,7 @@ containsIf(Iterator begin, Iterator end, BinaryPredicate predicate, Execution ex
         return pos != end;
     }
     else {
-        const Iterator pos = std::find_if(execution, std::move(begin), end, std::move(predicate));
+        const Iterator pos = detail::executeFindIf(execution, begin, end, std::move(predicate));
         return pos != end;
     }
 }
@@ -903,13 +950,12 @@ template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {},
                 Execution execution = std::execution::seq) {
     if constexpr (detail::isCompatibleForExecution<Execution, IteratorA>()) {
-        return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+        return detail::search(std::move(beginA), endA, std::move(beginB), std::move(endB), std::move(compare));
     }
     else {
         static_assert(detail::IsForwardOrStrongerV<IteratorB>,
                       "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-        return std::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
-                           std::move(compare)) != endA;
+        return detail::executeSearch(execution, beginA, endA, beginB, endB, std::move(compare)) != endA;
     }
 }
 
@@ -972,14 +1018,14 @@ bool endsWith(const IterableA& a, const IterableB& b, BinaryPredicate compare =
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param size The size of the sequence
- * @note Uses std::distance to get the size of the iterator.
+ * @note Uses std::distance to get the size of the iterator. If the sequence is contiguous memory of arithmetic values of at least
+ * the size of an `int` (or an `lz::as` of those) and `binOp` is the default, the sum is computed in `double` (a 64 bit integer
+ * for integers) with multiple accumulators, so it does not overflow the value type.
  * @return The mean of the sequence.
  */
 template<class Iterator, class BinaryOp = MAKE_BIN_OP(std::plus, detail::ValueType<Iterator>)>
 double mean(Iterator begin, Iterator end, BinaryOp binOp = {}) {
-    using ValueType = detail::ValueType<Iterator>;
-    const ValueType sum = std::accumulate(begin, end, ValueType{ 0 }, std::move(binOp));
-    return static_cast<double>(sum) / static_cast<double>(static_cast<std::size_t>(std::distance(begin, end)));
+    return detail::mean(begin, end, std::move(binOp));
 }
 
 /**
@@ -1217,7 +1263,7 @@ std::size_t indexOfIf(const Iterable& iterable, UnaryFunc predicate) {
  */
 template<class Iterator, class T>
 bool contains(Iterator begin, Iterator end, const T& value) {
-    return std::find(std::move(begin), end, value) != end;
+    return detail::contains(std::move(begin), end, value);
 }
 
 /**
@@ -1269,7 +1315,7 @@ bool containsIf(const Iterable& iterable, BinaryPredicate predicate) {
  */
 template<class IteratorA, class IteratorB, class BinaryPredicate = MAKE_BIN_OP(std::equal_to, detail::ValueType<IteratorA>)>
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {}) {
-    return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+    return detail::search(std::move(beginA), endA, std::move(beginB), std::move(endB), std::move(compare));
 }
 
 /**
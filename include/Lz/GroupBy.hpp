@@ -4,6 +4,7 @@
 #define LZ_GROUP_BY_HPP
 
 #include "detail/BasicIteratorView.hpp"
+#include "detail/iterators/GroupByAggregateIterator.hpp"
 #include "detail/iterators/GroupByIterator.hpp"
 
 namespace lz {
@@ -23,11 +24,11 @@ class GroupBy final : public detail::BasicIteratorView<detail::GroupByIterator<I
 
 public:
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 GroupBy(Iterator begin, Iterator end, Comparer comparer, Execution execution) :
+    LZ_CONSTEXPR_CXX_20 GroupBy(Iterator begin, Iterator end, detail::FunctionStorage<Comparer> comparer, Execution execution) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, comparer, execution),
                                             iterator(end, end, comparer, execution))
 #else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
-    GroupBy(Iterator begin, Iterator end, Comparer comparer) :
+    GroupBy(Iterator begin, Iterator end, detail::FunctionStorage<Comparer> comparer) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, comparer), iterator(end, end, comparer))
 #endif // LZ_HAS_EXECUTION
     {
@@ -36,6 +37,52 @@ public:
     constexpr GroupBy() = default;
 };
 
+template<class Key, class T>
+class GroupByAggregate final : public detail::BasicIteratorView<detail::GroupByAggregateIterator<Key, T>> {
+public:
+    using iterator = detail::GroupByAggregateIterator<Key, T>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Table = typename iterator::Table;
+
+    explicit GroupByAggregate(const std::shared_ptr<const Table>& table) :
+        detail::BasicIteratorView<iterator>(iterator(table, 0), iterator(table, table->size())) {
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    template<class Execution, class Iterator, class KeySelector, class Accumulate, class Combine>
+    static std::shared_ptr<const Table> makeTable(Execution execution, Iterator begin, Iterator end, KeySelector& keySelector,
+                                                  const T& init, Accumulate& accumulate, Combine& combine) {
+        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>() || !detail::Partitioner<Iterator>::value) {
+            static_cast<void>(execution);
+            static_cast<void>(combine);
+            return std::make_shared<const Table>(std::move(begin), std::move(end), keySelector, init, accumulate);
+        }
+        else {
+            return std::make_shared<const Table>(execution, begin, end, keySelector, init, accumulate, combine);
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
+public:
+    template<class Iterator, class KeySelector, class Accumulate>
+    GroupByAggregate(Iterator begin, Iterator end, KeySelector keySelector, const T& init, Accumulate accumulate) :
+        GroupByAggregate(std::make_shared<const Table>(std::move(begin), std::move(end), keySelector, init, accumulate)) {
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    template<class Iterator, class KeySelector, class Accumulate, class Combine, class Execution>
+    GroupByAggregate(Iterator begin, Iterator end, KeySelector keySelector, const T& init, Accumulate accumulate,
+                     Combine combine, Execution execution) :
+        GroupByAggregate(makeTable(execution, std::move(begin), std::move(end), keySelector, init, accumulate, combine)) {
+    }
+#endif // LZ_HAS_EXECUTION
+
+    constexpr GroupByAggregate() = default;
+};
+
 /**
  * @addtogroup ItFns
  * @{
@@ -47,7 +94,7 @@ public:
  * @attention [begin, end) must be sorted in order to work properly.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
- * @param execution The execution policy for finding, sorting and checking if the sequence is sorted.
+ * @param execution The execution policy. The find itself is sequential; pass the policy to the terminal operation instead.
  * @param comparer The comparer to make groups with. For e.g. if value_type is string, one can use
  * `[](string a, string b) { return a.length() == b.length() }` to make groups where sizes of the strings are equal.
  * @return A GroupBy iterator view object.
@@ -61,7 +108,7 @@ groupByRange(Iterator begin, Iterator end, Comparer comparer = {}, Execution exe
 /**
  * Chops a sequence into chunks, where every chunk is grouped based on a grouping predicate.
  * @param iterable The iterable to group into chunks.
- * @param execution The execution policy for finding, sorting and checking if the sequence is sorted.
+ * @param execution The execution policy. The find itself is sequential; pass the policy to the terminal operation instead.
  * @param comparer The comparer to make groups with. For e.g. if value_type is string, one can use
  * `[](string a, string b) { return a.length() == b.length() }` to make groups where sizes of the strings are equal.
  * @return A GroupBy iterator view object.
@@ -72,6 +119,58 @@ groupBy(Iterable&& iterable, Comparer comparer = {}, Execution execution = std::
     return groupByRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
                         std::move(comparer), execution);
 }
+/**
+ * Aggregates every element of [begin, end) into the group of its key, in a single pass, and returns a `(key, aggregate)` pair for
+ * every group. Contrary to `groupByRange`, [begin, end) does not need to be sorted. If `execution` is not sequenced and the
+ * sequence can be split, every thread aggregates a part of the sequence into its own hash map, after which the maps are merged
+ * using `combine`. The groups are in the order in which their keys first appear, regardless of the execution policy.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Returns the key of an element, e.g. `[](const Order& o) { return o.customerId; }`.
+ * @param init The initial aggregate of every group. If the aggregation runs in parallel, the aggregate of every part of a group
+ * starts from `init`, so `init` must be the identity of `combine`: `combine(init, x) == x` (e.g. 0 for a sum, 1 for a product).
+ * @param accumulate Adds an element to the aggregate of its group: `fn(T aggregate, decltype(*begin)) -> T`.
+ * @param combine Combines the aggregates of two parts of the same group: `fn(T aggregate, T aggregate) -> T`. Must be
+ * associative.
+ * @param execution The execution policy. Must be one of `std::execution::*`.
+ * @return A GroupByAggregate view object, which yields `std::pair<const Key&, const T&>` values.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector, class T, class Accumulate, class Combine,
+         class Execution = std::execution::sequenced_policy,
+         class Key = detail::Decay<detail::FunctionReturnType<KeySelector, detail::RefType<Iterator>>>>
+LZ_NODISCARD GroupByAggregate<Key, detail::Decay<T>>
+groupByAggregateRange(Iterator begin, Iterator end, KeySelector keySelector, T&& init, Accumulate accumulate, Combine combine,
+                      Execution execution = std::execution::seq) {
+    return { std::move(begin), std::move(end), std::move(keySelector), std::forward<T>(init), std::move(accumulate),
+             std::move(combine), execution };
+}
+
+/**
+ * Aggregates every element of `iterable` into the group of its key, in a single pass, and returns a `(key, aggregate)` pair for
+ * every group. Contrary to `groupBy`, `iterable` does not need to be sorted. If `execution` is not sequenced and the sequence can
+ * be split, every thread aggregates a part of the sequence into its own hash map, after which the maps are merged using
+ * `combine`. The groups are in the order in which their keys first appear, regardless of the execution policy.
+ * @param iterable The iterable to aggregate.
+ * @param keySelector Returns the key of an element, e.g. `[](const Order& o) { return o.customerId; }`.
+ * @param init The initial aggregate of every group. If the aggregation runs in parallel, the aggregate of every part of a group
+ * starts from `init`, so `init` must be the identity of `combine`: `combine(init, x) == x` (e.g. 0 for a sum, 1 for a product).
+ * @param accumulate Adds an element to the aggregate of its group: `fn(T aggregate, decltype(*begin)) -> T`.
+ * @param combine Combines the aggregates of two parts of the same group: `fn(T aggregate, T aggregate) -> T`. Must be
+ * associative.
+ * @param execution The execution policy. Must be one of `std::execution::*`.
+ * @return A GroupByAggregate view object, which yields `std::pair<const Key&, const T&>` values.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class T, class Accumulate, class Combine,
+         class Execution = std::execution::sequenced_policy,
+         class Key = detail::Decay<
+             detail::FunctionReturnType<KeySelector, detail::RefType<detail::IterTypeFromIterable<Iterable>>>>>
+LZ_NODISCARD GroupByAggregate<Key, detail::Decay<T>>
+groupByAggregate(Iterable&& iterable, KeySelector keySelector, T&& init, Accumulate accumulate, Combine combine,
+                 Execution execution = std::execution::seq) {
+    return groupByAggregateRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                                 std::move(keySelector), std::forward<T>(init), std::move(accumulate), std::move(combine),
+                                 execution);
+}
 #else // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
 
 /**
@@ -104,6 +203,45 @@ GroupBy<detail::IterTypeFromIterable<Iterable>, Comparer> groupBy(Iterable&& ite
 
 #endif // end LZ_HAS_EXECUTION
 
+/**
+ * Aggregates every element of [begin, end) into the group of its key, in a single pass, and returns a `(key, aggregate)` pair for
+ * every group. Contrary to `groupByRange`, [begin, end) does not need to be sorted: the aggregates are kept in a flat hash map,
+ * which replaces sorting, grouping and folding by a single O(n) pass. The groups are in the order in which their keys first
+ * appear. The aggregation is done when the view is created.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Returns the key of an element, e.g. `[](const Order& o) { return o.customerId; }`.
+ * @param init The initial aggregate of every group.
+ * @param accumulate Adds an element to the aggregate of its group: `fn(T aggregate, decltype(*begin)) -> T`.
+ * @return A GroupByAggregate view object, which yields `std::pair<const Key&, const T&>` values.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector, class T, class Accumulate,
+         class Key = detail::Decay<detail::FunctionReturnType<KeySelector, detail::RefType<Iterator>>>>
+LZ_NODISCARD GroupByAggregate<Key, detail::Decay<T>>
+groupByAggregateRange(Iterator begin, Iterator end, KeySelector keySelector, T&& init, Accumulate accumulate) {
+    return { std::move(begin), std::move(end), std::move(keySelector), std::forward<T>(init), std::move(accumulate) };
+}
+
+/**
+ * Aggregates every element of `iterable` into the group of its key, in a single pass, and returns a `(key, aggregate)` pair for
+ * every group. Contrary to `groupBy`, `iterable` does not need to be sorted: the aggregates are kept in a flat hash map, which
+ * replaces sorting, grouping and folding by a single O(n) pass. The groups are in the order in which their keys first appear.
+ * The aggregation is done when the view is created.
+ * @param iterable The iterable to aggregate.
+ * @param keySelector Returns the key of an element, e.g. `[](const Order& o) { return o.customerId; }`.
+ * @param init The initial aggregate of every group.
+ * @param accumulate Adds an element to the aggregate of its group: `fn(T aggregate, decltype(*begin)) -> T`.
+ * @return A GroupByAggregate view object, which yields `std::pair<const Key&, const T&>` values.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class T, class Accumulate,
+         class Key = detail::Decay<
+             detail::FunctionReturnType<KeySelector, detail::RefType<detail::IterTypeFromIterable<Iterable>>>>>
+LZ_NODISCARD GroupByAggregate<Key, detail::Decay<T>>
+groupByAggregate(Iterable&& iterable, KeySelector keySelector, T&& init, Accumulate accumulate) {
+    return groupByAggregateRange(detail::begin(std::forward<Iterable>(iterable)), detail::end(std::forward<Iterable>(iterable)),
+                                 std::move(keySelector), std::forward<T>(init), std::move(accumulate));
+}
+
 // End of group
 /**
  * @}
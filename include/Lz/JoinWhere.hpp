@@ -4,7 +4,10 @@
 #define LZ_JOIN_WHERE_HPP
 
 #include "detail/BasicIteratorView.hpp"
+#include "detail/iterators/HashJoinWhereIterator.hpp"
 #include "detail/iterators/JoinWhereIterator.hpp"
+#include "detail/iterators/MergeJoinWhereIterator.hpp"
+#include "detail/iterators/SemiJoinIterator.hpp"
 
 namespace lz {
 
@@ -29,15 +32,16 @@ public:
 
 public:
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 JoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b,
-                                  ResultSelector resultSelector, Execution execution) :
+    LZ_CONSTEXPR_CXX_20 JoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, detail::FunctionStorage<SelectorA> a,
+                                  detail::FunctionStorage<SelectorB> b, detail::FunctionStorage<ResultSelector> resultSelector,
+                                  Execution execution) :
         detail::BasicIteratorView<iterator>(
             iterator(std::move(iterA), endA, std::move(iterB), endB, a, b, resultSelector, execution),
             iterator(endA, endA, endB, endB, a, b, resultSelector, execution)) {
     }
 #else
-    LZ_CONSTEXPR_CXX_20
-    JoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) :
+    LZ_CONSTEXPR_CXX_20 JoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, detail::FunctionStorage<SelectorA> a,
+                                  detail::FunctionStorage<SelectorB> b, detail::FunctionStorage<ResultSelector> resultSelector) :
         detail::BasicIteratorView<iterator>(iterator(std::move(iterA), endA, std::move(iterB), endB, a, b, resultSelector),
                                             iterator(endA, endA, endB, endB, a, b, resultSelector)) {
     }
@@ -46,6 +50,123 @@ public:
     constexpr JoinWhere() = default;
 };
 
+#ifdef LZ_HAS_EXECUTION
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, class Execution>
+#else
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+#endif // LZ_HAS_EXECUTION
+class HashJoinWhere final
+    : public detail::BasicIteratorView<detail::HashJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+public:
+    using iterator = detail::HashJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Table = typename iterator::Table;
+
+    HashJoinWhere(IterA iterA, IterA endA, const std::shared_ptr<const Table>& table, detail::FunctionStorage<SelectorA> a,
+                  detail::FunctionStorage<ResultSelector> resultSelector) :
+        detail::BasicIteratorView<iterator>(iterator(std::move(iterA), endA, table, a, resultSelector),
+                                            iterator(endA, endA, table, a, resultSelector)) {
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    static std::shared_ptr<const Table> makeTable(IterB iterB, IterB endB, SelectorB& b, Execution execution) {
+        if constexpr (detail::isCompatibleForExecution<Execution, IterB>() || !detail::IsRandomAccess<IterB>::value) {
+            static_cast<void>(execution);
+            return std::make_shared<const Table>(std::move(iterB), std::move(endB), b);
+        }
+        else {
+            return std::make_shared<const Table>(execution, std::move(iterB), std::move(endB), b);
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
+public:
+#ifdef LZ_HAS_EXECUTION
+    HashJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                  Execution execution) :
+        HashJoinWhere(std::move(iterA), std::move(endA), makeTable(std::move(iterB), std::move(endB), b, execution), std::move(a),
+                      std::move(resultSelector)) {
+    }
+#else
+    HashJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) :
+        HashJoinWhere(std::move(iterA), std::move(endA), std::make_shared<const Table>(std::move(iterB), std::move(endB), b),
+                      std::move(a), std::move(resultSelector)) {
+    }
+#endif // LZ_HAS_EXECUTION
+
+    constexpr HashJoinWhere() = default;
+};
+
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+class MergeJoinWhere final
+    : public detail::BasicIteratorView<detail::MergeJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+public:
+    using iterator = detail::MergeJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 MergeJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, detail::FunctionStorage<SelectorA> a,
+                                       detail::FunctionStorage<SelectorB> b,
+                                       detail::FunctionStorage<ResultSelector> resultSelector) :
+        detail::BasicIteratorView<iterator>(iterator(std::move(iterA), endA, std::move(iterB), endB, a, b, resultSelector),
+                                            iterator(endA, endA, endB, endB, a, b, resultSelector)) {
+    }
+
+    constexpr MergeJoinWhere() = default;
+};
+
+// Statistics of the bloom filter of a semi or anti join, see `SemiJoinView::filterStats`
+using SemiJoinStats = detail::SemiJoinStats;
+
+template<class Iterator, class IterB, class SelectorA, class SelectorB, bool Anti, bool CollectStats>
+class SemiJoinView final
+    : public detail::BasicIteratorView<detail::SemiJoinIterator<Iterator, IterB, SelectorA, SelectorB, Anti, CollectStats>> {
+public:
+    using iterator = detail::SemiJoinIterator<Iterator, IterB, SelectorA, SelectorB, Anti, CollectStats>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Table = typename iterator::Table;
+
+    std::shared_ptr<const Table> _table{};
+
+    SemiJoinView(Iterator begin, Iterator end, const std::shared_ptr<const Table>& table, detail::FunctionStorage<SelectorA> a) :
+        detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, table, a), iterator(end, end, table, a)),
+        _table(table) {
+    }
+
+public:
+    SemiJoinView(Iterator begin, Iterator end, IterB iterB, IterB endB, SelectorA a, SelectorB b,
+                 const double falsePositiveRate) :
+        SemiJoinView(std::move(begin), std::move(end),
+                     std::make_shared<const Table>(std::move(iterB), std::move(endB), b, falsePositiveRate), std::move(a)) {
+    }
+
+    constexpr SemiJoinView() = default;
+
+    /**
+     * Returns how many keys have been looked up so far by the iterators of this view, and how many of those were answered by the
+     * bloom filter alone. If only a small fraction is rejected by the filter, most keys are in B and the filter only adds
+     * overhead. Only available if the view is created with `CollectStats` set to true, e.g. `lz::semiJoin<true>(...)`.
+     * @return The statistics of the bloom filter.
+     */
+    LZ_NODISCARD SemiJoinStats filterStats() const noexcept {
+        static_assert(CollectStats,
+                      "Statistics are only collected by views created with lz::semiJoin<true> or lz::antiJoin<true>");
+        return _table ? _table->stats() : SemiJoinStats{ 0, 0, 0 };
+    }
+};
+
+template<class Iterator, class IterB, class SelectorA, class SelectorB, bool CollectStats = false>
+using SemiJoin = SemiJoinView<Iterator, IterB, SelectorA, SelectorB, false, CollectStats>;
+
+template<class Iterator, class IterB, class SelectorA, class SelectorB, bool CollectStats = false>
+using AntiJoin = SemiJoinView<Iterator, IterB, SelectorA, SelectorB, true, CollectStats>;
+
 /**
  * @addtogroup ItFns
  * @{
@@ -67,7 +188,9 @@ public:
  * @param resultSelector A function that takes two parameters as its arguments. The value type of iterator a and the value type
  * of iterator b. Once a match of `a == b` is found, this function will be called, and a result can be returned, for e.g.
  * `std::make_tuple(valueTypeA, valueTypeB)`.
- * @param execution The execution policy. Must be any of std::execution::*
+ * @param execution The execution policy. Must be any of std::execution::*. Only kept for compatibility; the join itself is
+ * sequential. Pass the policy to the terminal operation instead (e.g. `to<std::vector>(std::execution::par)`), which joins sub
+ * ranges of A on separate threads and concatenates their results in order.
  * @return A join where iterator view object, which can be used to iterate over.
  */
 template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector,
@@ -96,7 +219,9 @@ joinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, Selecto
  * @param resultSelector A function that takes two parameters as its arguments. The value type of iterable `iterableA` and the
  * value type of iterable `iterableB`. Once a match of `a == b` is found, this function will be called, and a result can be
  * returned, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
- * @param execution The execution policy. Must be any of std::execution::*
+ * @param execution The execution policy. Must be any of std::execution::*. Only kept for compatibility; the join itself is
+ * sequential. Pass the policy to the terminal operation instead (e.g. `to<std::vector>(std::execution::par)`), which joins sub
+ * ranges of A on separate threads and concatenates their results in order.
  * @return A join where iterator view object, which can be used to iterate over.
  */
 template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector,
@@ -109,6 +234,71 @@ joinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b
                      detail::begin(std::forward<IterableB>(iterableB)), detail::end(std::forward<IterableB>(iterableB)),
                      std::move(a), std::move(b), std::move(resultSelector), execution);
 }
+
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator==`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, [iterB, endB) does not need to be sorted: a hash table of the
+ * keys of `b` is built once when the view is created and is shared by all of its iterators, after which every element of A is
+ * looked up in O(1). All matches are returned, in the order of A, and for duplicate keys in B in the order of B.
+ * @attention The result of `b` must be hashable by `std::hash` and the view keeps iterators to [iterB, endB), so it must outlive
+ * this view.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterator a and the value type
+ * of iterator b. Once a match of `a == b` is found, this function will be called, and a result can be returned, for e.g.
+ * `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @param execution The execution policy. Must be any of std::execution::*. If it is a parallel policy and B is random access,
+ * the hash table is built by multiple threads, one partition of the keys per thread. Iterating is sequential, pass the policy
+ * to the terminal operation as well (e.g. `to<std::vector>(std::execution::par)`) to probe sub ranges of A on separate threads.
+ * @return A hash join where iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashJoinWhere<IterA, IterB, SelectorA, SelectorB, ResultSelector, Execution>
+hashJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+              Execution execution = std::execution::seq) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector), execution
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator==`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, iterableB does not need to be sorted: a hash table of the keys
+ * of `b` is built once when the view is created and is shared by all of its iterators, after which every element of
+ * `iterableA` is looked up in O(1). All matches are returned, in the order of `iterableA`, and for duplicate keys in
+ * `iterableB` in the order of `iterableB`.
+ * @attention The result of `b` must be hashable by `std::hash` and `iterableB` must outlive this view.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterable `iterableA` and the
+ * value type of iterable `iterableB`. Once a match of `a == b` is found, this function will be called, and a result can be
+ * returned, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @param execution The execution policy. Must be any of std::execution::*. If it is a parallel policy and `iterableB` is random
+ * access, the hash table is built by multiple threads, one partition of the keys per thread. Iterating is sequential, pass the
+ * policy to the terminal operation as well (e.g. `to<std::vector>(std::execution::par)`) to probe sub ranges of `iterableA` on
+ * separate threads.
+ * @return A hash join where iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD HashJoinWhere<detail::IterTypeFromIterable<IterableA>, detail::IterTypeFromIterable<IterableB>, SelectorA,
+                           SelectorB, ResultSelector, Execution>
+hashJoinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+              Execution execution = std::execution::seq) {
+    return hashJoinWhere(detail::begin(std::forward<IterableA>(iterableA)), detail::end(std::forward<IterableA>(iterableA)),
+                         detail::begin(std::forward<IterableB>(iterableB)), detail::end(std::forward<IterableB>(iterableB)),
+                         std::move(a), std::move(b), std::move(resultSelector), execution);
+}
 #else
 /**
  * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator<`, and returns
@@ -161,8 +351,225 @@ joinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b
                      std::move(a), std::move(b), std::move(resultSelector));
 }
 
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator==`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, [iterB, endB) does not need to be sorted: a hash table of the
+ * keys of `b` is built once when the view is created and is shared by all of its iterators, after which every element of A is
+ * looked up in O(1). All matches are returned, in the order of A, and for duplicate keys in B in the order of B.
+ * @attention The result of `b` must be hashable by `std::hash` and the view keeps iterators to [iterB, endB), so it must outlive
+ * this view.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterator a and the value type
+ * of iterator b. Once a match of `a == b` is found, this function will be called, and a result can be returned, for e.g.
+ * `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A hash join where iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoinWhere<IterA, IterB, SelectorA, SelectorB, ResultSelector>
+hashJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector)
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator==`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, iterableB does not need to be sorted: a hash table of the keys
+ * of `b` is built once when the view is created and is shared by all of its iterators, after which every element of
+ * `iterableA` is looked up in O(1). All matches are returned, in the order of `iterableA`, and for duplicate keys in
+ * `iterableB` in the order of `iterableB`.
+ * @attention The result of `b` must be hashable by `std::hash` and `iterableB` must outlive this view.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterable `iterableA` and the
+ * value type of iterable `iterableB`. Once a match of `a == b` is found, this function will be called, and a result can be
+ * returned, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A hash join where iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoinWhere<detail::IterTypeFromIterable<IterableA>, detail::IterTypeFromIterable<IterableB>, SelectorA,
+                           SelectorB, ResultSelector>
+hashJoinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return hashJoinWhere(detail::begin(std::forward<IterableA>(iterableA)), detail::end(std::forward<IterableA>(iterableA)),
+                         detail::begin(std::forward<IterableB>(iterableB)), detail::end(std::forward<IterableB>(iterableB)),
+                         std::move(a), std::move(b), std::move(resultSelector));
+}
+
 #endif // LZ_HAS_EXECUTION
 
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator<`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, both [iterA, endA) and [iterB, endB) must be sorted by their key,
+ * which allows both sequences to be walked only once: O(n + m) instead of a binary search per element of A. Long runs of
+ * elements without a match are skipped using galloping (exponential) search. Duplicate keys on both sides are supported, every
+ * element of A is combined with every element of B that has the same key.
+ * @attention [iterA, endA) and [iterB, endB) must both be sorted on the result of `a` and `b` respectively.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterator a and the value type
+ * of iterator b. Once a match of `a == b` is found, this function will be called, and a result can be returned, for e.g.
+ * `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A merge join where iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MergeJoinWhere<IterA, IterB, SelectorA, SelectorB, ResultSelector>
+mergeJoinWhere(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector)
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator<`, and returns
+ * `resultSelector` if those are equal. Contrary to `joinWhere`, both `iterableA` and `iterableB` must be sorted by their key,
+ * which allows both sequences to be walked only once: O(n + m) instead of a binary search per element of `iterableA`. Long runs
+ * of elements without a match are skipped using galloping (exponential) search. Duplicate keys on both sides are supported,
+ * every element of `iterableA` is combined with every element of `iterableB` that has the same key.
+ * @attention `iterableA` and `iterableB` must both be sorted on the result of `a` and `b` respectively.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns a key-like value to compare the result of `b` with.
+ * @param b A function that returns a key-like value to compare the result of `a` with.
+ * @param resultSelector A function that takes two parameters as its arguments. The value type of iterable `iterableA` and the
+ * value type of iterable `iterableB`. Once a match of `a == b` is found, this function will be called, and a result can be
+ * returned, for e.g. `std::make_tuple(valueTypeA, valueTypeB)`.
+ * @return A merge join where iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MergeJoinWhere<detail::IterTypeFromIterable<IterableA>, detail::IterTypeFromIterable<IterableB>,
+                                                SelectorA, SelectorB, ResultSelector>
+mergeJoinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return mergeJoinWhere(detail::begin(std::forward<IterableA>(iterableA)), detail::end(std::forward<IterableA>(iterableA)),
+                          detail::begin(std::forward<IterableB>(iterableB)), detail::end(std::forward<IterableB>(iterableB)),
+                          std::move(a), std::move(b), std::move(resultSelector));
+}
+
+/**
+ * Returns the elements of [iterA, endA) of which the key `a` is equal to the key `b` of any element in [iterB, endB). Every
+ * element of A is returned at most once, regardless of how many elements in B have the same key. The keys of B are stored once,
+ * when the view is created, in a hash set that is guarded by a blocked bloom filter. A key that is not in B is in most cases
+ * rejected by the filter, which touches a single cache line, instead of by the hash set. Use `lz::semiJoin<true>` and
+ * `filterStats()` on the returned view to see how many probes the filter answered.
+ * @attention The key of B must be hashable by `std::hash` and comparable with the key of A using `operator==`.
+ * @tparam CollectStats Whether every probe is counted, see `SemiJoinView::filterStats`. Off by default, because the counters are
+ * shared by all iterators of the view.
+ * @param iterA The beginning of the sequence to filter.
+ * @param endA The ending of the sequence to filter.
+ * @param iterB The beginning of the sequence with the keys to look for.
+ * @param endB The ending of the sequence with the keys to look for.
+ * @param a A function that returns the key of an element of A.
+ * @param b A function that returns the key of an element of B.
+ * @param falsePositiveRate The fraction of keys that are not in B, that may pass the bloom filter. A lower rate makes the filter
+ * larger.
+ * @return A semi join view object, which can be used to iterate over.
+ */
+template<bool CollectStats = false, class IterA, class IterB, class SelectorA, class SelectorB>
+LZ_NODISCARD SemiJoin<IterA, IterB, SelectorA, SelectorB, CollectStats>
+semiJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b), falsePositiveRate
+    };
+    // clang-format on
+}
+
+/**
+ * Returns the elements of `iterableA` of which the key `a` is equal to the key `b` of any element in `iterableB`. Every element
+ * of `iterableA` is returned at most once, regardless of how many elements in `iterableB` have the same key. The keys of
+ * `iterableB` are stored once, when the view is created, in a hash set that is guarded by a blocked bloom filter. A key that is
+ * not in `iterableB` is in most cases rejected by the filter, which touches a single cache line, instead of by the hash set. Use
+ * `lz::semiJoin<true>` and `filterStats()` on the returned view to see how many probes the filter answered.
+ * @attention The key of `iterableB` must be hashable by `std::hash` and comparable with the key of `iterableA` using
+ * `operator==`.
+ * @tparam CollectStats Whether every probe is counted, see `SemiJoinView::filterStats`.
+ * @param iterableA The sequence to filter.
+ * @param iterableB The sequence with the keys to look for.
+ * @param a A function that returns the key of an element of `iterableA`.
+ * @param b A function that returns the key of an element of `iterableB`.
+ * @param falsePositiveRate The fraction of keys that are not in `iterableB`, that may pass the bloom filter. A lower rate makes
+ * the filter larger.
+ * @return A semi join view object, which can be used to iterate over.
+ */
+template<bool CollectStats = false, class IterableA, class IterableB, class SelectorA, class SelectorB>
+LZ_NODISCARD
+SemiJoin<detail::IterTypeFromIterable<IterableA>, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, CollectStats>
+semiJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) {
+    return semiJoin<CollectStats>(detail::begin(std::forward<IterableA>(iterableA)),
+                                  detail::end(std::forward<IterableA>(iterableA)),
+                                  detail::begin(std::forward<IterableB>(iterableB)),
+                                  detail::end(std::forward<IterableB>(iterableB)), std::move(a), std::move(b),
+                                  falsePositiveRate);
+}
+
+/**
+ * Returns the elements of [iterA, endA) of which the key `a` is not equal to the key `b` of any element in [iterB, endB). This is
+ * the complement of `semiJoin`, and uses the same bloom filter guarded hash set: most elements of A that must be returned only
+ * touch the filter.
+ * @attention The key of B must be hashable by `std::hash` and comparable with the key of A using `operator==`.
+ * @tparam CollectStats Whether every probe is counted, see `SemiJoinView::filterStats`.
+ * @param iterA The beginning of the sequence to filter.
+ * @param endA The ending of the sequence to filter.
+ * @param iterB The beginning of the sequence with the keys to skip.
+ * @param endB The ending of the sequence with the keys to skip.
+ * @param a A function that returns the key of an element of A.
+ * @param b A function that returns the key of an element of B.
+ * @param falsePositiveRate The fraction of keys that are not in B, that may pass the bloom filter. A lower rate makes the filter
+ * larger.
+ * @return An anti join view object, which can be used to iterate over.
+ */
+template<bool CollectStats = false, class IterA, class IterB, class SelectorA, class SelectorB>
+LZ_NODISCARD AntiJoin<IterA, IterB, SelectorA, SelectorB, CollectStats>
+antiJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b), falsePositiveRate
+    };
+    // clang-format on
+}
+
+/**
+ * Returns the elements of `iterableA` of which the key `a` is not equal to the key `b` of any element in `iterableB`. This is the
+ * complement of `semiJoin`, and uses the same bloom filter guarded hash set: most elements of `iterableA` that must be returned
+ * only touch the filter.
+ * @attention The key of `iterableB` must be hashable by `std::hash` and comparable with the key of `iterableA` using
+ * `operator==`.
+ * @tparam CollectStats Whether every probe is counted, see `SemiJoinView::filterStats`.
+ * @param iterableA The sequence to filter.
+ * @param iterableB The sequence with the keys to skip.
+ * @param a A function that returns the key of an element of `iterableA`.
+ * @param b A function that returns the key of an element of `iterableB`.
+ * @param falsePositiveRate The fraction of keys that are not in `iterableB`, that may pass the bloom filter. A lower rate makes
+ * the filter larger.
+ * @return An anti join view object, which can be used to iterate over.
+ */
+template<bool CollectStats = false, class IterableA, class IterableB, class SelectorA, class SelectorB>
+LZ_NODISCARD
+AntiJoin<detail::IterTypeFromIterable<IterableA>, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, CollectStats>
+antiJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) {
+    return antiJoin<CollectStats>(detail::begin(std::forward<IterableA>(iterableA)),
+                                  detail::end(std::forward<IterableA>(iterableA)),
+                                  detail::begin(std::forward<IterableB>(iterableB)),
+                                  detail::end(std::forward<IterableB>(iterableB)), std::move(a), std::move(b),
+                                  falsePositiveRate);
+}
+
 // End of group
 /**
  * @}
@@ -5,14 +5,17 @@
 
 #include "Lz/AnyView.hpp"
 #include "Lz/CString.hpp"
+#include "Lz/Cache.hpp"
 #include "Lz/CartesianProduct.hpp"
 #include "Lz/ChunkIf.hpp"
 #include "Lz/Chunks.hpp"
 #include "Lz/Concatenate.hpp"
+#include "Lz/Distinct.hpp"
 #include "Lz/Enumerate.hpp"
 #include "Lz/Except.hpp"
 #include "Lz/Exclude.hpp"
 #include "Lz/ExclusiveScan.hpp"
+#include "Lz/Execution.hpp"
 #include "Lz/Filter.hpp"
 #include "Lz/Flatten.hpp"
 #include "Lz/FunctionTools.hpp"
@@ -24,6 +27,7 @@
 #include "Lz/JoinWhere.hpp"
 #include "Lz/Loop.hpp"
 #include "Lz/Map.hpp"
+#include "Lz/Predicates.hpp"
 #include "Lz/Random.hpp"
 #include "Lz/Range.hpp"
 #include "Lz/RegexSplit.hpp"
@@ -35,21 +39,10 @@
 #include "Lz/Unique.hpp"
 #include "Lz/Zip.hpp"
 #include "Lz/ZipLongest.hpp"
+#include "Lz/detail/ArithmeticKernels.hpp"
+#include "Lz/detail/Fusion.hpp"
 
 namespace lz {
-#ifndef LZ_HAS_CXX_EXECUTION
-namespace detail {
-template<class Iterator, class T, class BinOp>
-T accumulate(Iterator begin, Iterator end, T init, BinOp binOp) {
-    while (begin != end) {
-        init = binOp(std::move(init), *begin);
-        ++begin;
-    }
-    return init;
-}
-} // namespace detail
-#endif // LZ_HAS_CXX_EXECUTION
-
 LZ_MODULE_EXPORT_SCOPE_BEGIN
 
 template<class Iterator>
@@ -129,12 +122,21 @@ public:
     }
 
     //! See Map.hpp for documentation
-    template<class UnaryFunction>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<detail::MapIterator<Iterator, UnaryFunction>>
-    map(UnaryFunction unaryFunction) const {
+    template<class UnaryFunction, class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+        detail::EnableIf<!detail::MapFusion<I, UnaryFunction>::value, IterView<detail::MapIterator<Iterator, UnaryFunction>>>
+        map(UnaryFunction unaryFunction) const {
         return chain(lz::map(*this, std::move(unaryFunction)));
     }
 
+    //! See Map.hpp for documentation. A map of a map is fused into one map that calls both functions, see Fusion.hpp
+    template<class UnaryFunction, class I = Iterator, class Fusion = detail::MapFusion<I, UnaryFunction>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 detail::EnableIf<Fusion::value, IterView<typename Fusion::iterator>>
+    map(UnaryFunction unaryFunction) const {
+        return chain(lz::mapRange(this->begin().base(), this->end().base(),
+                                  typename Fusion::Function(this->begin().function(), std::move(unaryFunction))));
+    }
+
     //! See TakeWhile.hpp for documentation.
     template<class UnaryPredicate>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto takeWhile(UnaryPredicate predicate) const
@@ -143,12 +145,23 @@ public:
     }
 
     //! See Take.hpp for documentation. Internally uses lz::take to take the amounts
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto take(const difference_type amount) const
-        -> decltype(chain(lz::take(this->begin(), amount))) {
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+        detail::EnableIf<!detail::IsTakeNIterator<I>::value, IterView<detail::TakeNIterator<Iterator>>>
+        take(const difference_type amount) const {
         return chain(lz::take(this->begin(), amount));
     }
 
-    //! Drops the first amount elements from this iterator. Internally uses std::next to add an amount
+    //! See Take.hpp for documentation. A take of a take is fused into one take of the smallest amount, see Fusion.hpp
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 detail::EnableIf<detail::IsTakeNIterator<I>::value, IterView>
+    take(const difference_type amount) const {
+        const difference_type size = this->end().difference(this->begin());
+        return chain(lz::take(this->begin().base(), amount < size ? amount : size));
+    }
+
+    //! Drops the first amount elements from this iterator. Internally uses std::next to add an amount, so a drop of a drop is
+    //! already a single view of the same iterator type
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto drop(const difference_type amount) const
         -> decltype(chain(lz::dropRange(this->begin(), this->end(), amount))) {
         return chain(lz::drop(*this, amount));
@@ -186,10 +199,10 @@ public:
         return chain(lz::zipWith(std::move(fn), *this, std::forward<Iterables>(iterables)...));
     }
 
-    //! See FunctionTools.hpp `as` for documentation.
+    //! See FunctionTools.hpp `as` for documentation. Fused with a preceding map, see Fusion.hpp
     template<class T>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<detail::MapIterator<Iterator, detail::ConvertFn<T>>> as() const {
-        return chain(lz::as<T>(*this));
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto as() const -> decltype(this->map(detail::ConvertFn<T>())) {
+        return map(detail::ConvertFn<T>());
     }
 
     //! See FunctionTools.hpp `reverse` for documentation.
@@ -231,6 +244,58 @@ public:
         return chain(lz::exclude(*this, from, to));
     }
 
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<
+        detail::MergeJoinWhereIterator<Iterator, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, ResultSelector>>
+    mergeJoinWhere(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return chain(lz::mergeJoinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB>
+    LZ_NODISCARD
+    IterView<detail::SemiJoinIterator<Iterator, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, false, false>>
+    semiJoin(IterableB&& iterableB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) const {
+        return chain(lz::semiJoin(*this, iterableB, std::move(a), std::move(b), falsePositiveRate));
+    }
+
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB>
+    LZ_NODISCARD
+    IterView<detail::SemiJoinIterator<Iterator, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, true, false>>
+    antiJoin(IterableB&& iterableB, SelectorA a, SelectorB b, const double falsePositiveRate = 0.01) const {
+        return chain(lz::antiJoin(*this, iterableB, std::move(a), std::move(b), falsePositiveRate));
+    }
+
+    //! See Cache.hpp for documentation.
+    LZ_NODISCARD IterView<detail::CacheIterator<Iterator>> cache() const {
+        return chain(lz::cache(*this));
+    }
+
+    //! See Distinct.hpp for documentation.
+    template<class Hash = std::hash<value_type>, class KeyEqual = MAKE_BIN_OP(std::equal_to, value_type)>
+    LZ_NODISCARD IterView<detail::DistinctIterator<Iterator, detail::IdentityKey, Hash, KeyEqual>>
+    distinct(Hash hash = {}, KeyEqual keyEqual = {}) const {
+        return chain(lz::distinct(*this, std::move(hash), std::move(keyEqual)));
+    }
+
+    //! See Distinct.hpp for documentation.
+    template<class KeySelector, class Key = detail::Decay<detail::FunctionReturnType<KeySelector, reference>>,
+             class Hash = std::hash<Key>, class KeyEqual = MAKE_BIN_OP(std::equal_to, Key)>
+    LZ_NODISCARD IterView<detail::DistinctIterator<Iterator, KeySelector, Hash, KeyEqual>>
+    distinctBy(KeySelector keySelector, Hash hash = {}, KeyEqual keyEqual = {}) const {
+        return chain(lz::distinctBy(*this, std::move(keySelector), std::move(hash), std::move(keyEqual)));
+    }
+
+    //! See GroupBy.hpp for documentation
+    template<class KeySelector, class T, class Accumulate,
+             class Key = detail::Decay<detail::FunctionReturnType<KeySelector, reference>>>
+    LZ_NODISCARD IterView<detail::GroupByAggregateIterator<Key, detail::Decay<T>>>
+    groupByAggregate(KeySelector keySelector, T&& init, Accumulate accumulate) const {
+        return chain(lz::groupByAggregate(*this, std::move(keySelector), std::forward<T>(init), std::move(accumulate)));
+    }
+
     // clang-format off
     //! See InclusiveScan.hpp for documentation.
     template<class T = value_type, class BinaryOp = MAKE_BIN_OP(std::plus, detail::ValueType<iterator>)>
@@ -275,14 +340,49 @@ public:
         return lz::backOr(*this, defaultValue);
     }
 
+    //! See FunctionTools.hpp for documentation
+    template<class T, class Accumulate, class Combine, class Execution = execution::PoolPolicy>
+    LZ_NODISCARD T
+    parallelReduce(T identity, Accumulate accumulate, Combine combine, Execution execution = execution::pool()) const {
+        return lz::parallelReduce(*this, std::move(identity), std::move(accumulate), std::move(combine), execution);
+    }
+
+    //! See BasicIteratorView.hpp for documentation
+    LZ_NODISCARD IterView<Iterator> partition(const std::size_t index, const std::size_t parts) const {
+        auto subView = Base::partition(index, parts);
+        return { subView.begin(), subView.end() };
+    }
+
+    //! See BasicIteratorView.hpp for documentation
+    LZ_NODISCARD std::vector<IterView<Iterator>> split(const std::size_t parts) const {
+        std::vector<IterView<Iterator>> subViews;
+        subViews.reserve(parts);
+        for (std::size_t index = 0; index < parts; ++index) {
+            subViews.push_back(partition(index, parts));
+        }
+        return subViews;
+    }
+
 #ifdef LZ_HAS_EXECUTION
     //! See Filter.hpp for documentation.
-    template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<detail::FilterIterator<Iterator, UnaryPredicate, Execution>>
+    template<class UnaryPredicate, class Execution = std::execution::sequenced_policy, class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 detail::EnableIf<!detail::FilterFusion<I, UnaryPredicate>::value,
+                                                      IterView<detail::FilterIterator<Iterator, UnaryPredicate, Execution>>>
     filter(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         return chain(lz::filter(*this, std::move(predicate), execution));
     }
 
+    //! See Filter.hpp for documentation. A filter of a filter is fused into one filter that tests both predicates, see
+    //! Fusion.hpp
+    template<class UnaryPredicate, class Execution = std::execution::sequenced_policy, class I = Iterator,
+             class Fusion = detail::FilterFusion<I, UnaryPredicate>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 detail::EnableIf<
+        Fusion::value, IterView<detail::FilterIterator<typename Fusion::BaseIterator, typename Fusion::Predicate, Execution>>>
+    filter(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
+        return chain(lz::filterRange(this->begin().base(), this->end().base(),
+                                     typename Fusion::Predicate(this->begin().predicate(), std::move(predicate)), execution));
+    }
+
     //! See Except.hpp for documentation.
     template<class IterableToExcept, class Execution = std::execution::sequenced_policy, class Compare = std::less<>>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20
@@ -291,6 +391,20 @@ public:
         return chain(lz::except(*this, toExcept, std::move(compare), execution));
     }
 
+    //! See Except.hpp for documentation.
+    template<class IterableToExcept, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD IterView<detail::HashExceptIterator<Iterator, detail::IterTypeFromIterable<IterableToExcept>>>
+    hashExcept(IterableToExcept&& toExcept, Execution execution = std::execution::seq) const {
+        return chain(lz::hashExcept(*this, toExcept, execution));
+    }
+
+    //! See Except.hpp for documentation
+    template<class IterableToExcept, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD IterView<detail::HashExceptIterator<Iterator, detail::IterTypeFromIterable<IterableToExcept>>>
+    hashExcept(IterableToExcept&& toExcept, const SortedTag tag, Execution execution = std::execution::seq) const {
+        return chain(lz::hashExcept(*this, toExcept, tag, execution));
+    }
+
     //! See Unique.hpp for documentation.
     template<class Execution = std::execution::sequenced_policy, class Compare = std::less<>>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<detail::UniqueIterator<Execution, Iterator, Compare>>
@@ -329,6 +443,16 @@ public:
         return chain(lz::joinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector), execution));
     }
 
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector,
+             class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD IterView<
+        detail::HashJoinWhereIterator<Iterator, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, ResultSelector>>
+    hashJoinWhere(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                  Execution execution = std::execution::seq) const {
+        return chain(lz::hashJoinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector), execution));
+    }
+
     //! See Take.hpp for documentation
     template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator>
@@ -343,6 +467,16 @@ public:
         return chain(lz::groupBy(*this, std::move(comparer), execution));
     }
 
+    //! See GroupBy.hpp for documentation
+    template<class KeySelector, class T, class Accumulate, class Combine, class Execution = std::execution::sequenced_policy,
+             class Key = detail::Decay<detail::FunctionReturnType<KeySelector, reference>>>
+    LZ_NODISCARD IterView<detail::GroupByAggregateIterator<Key, detail::Decay<T>>>
+    groupByAggregate(KeySelector keySelector, T&& init, Accumulate accumulate, Combine combine,
+                     Execution execution = std::execution::seq) const {
+        return chain(lz::groupByAggregate(*this, std::move(keySelector), std::forward<T>(init), std::move(accumulate),
+                                          std::move(combine), execution));
+    }
+
     //! See FunctionTools.hpp `trim` for documentation
     template<class UnaryPredicateFirst, class UnaryPredicateLast, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto
@@ -449,10 +583,13 @@ public:
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& forEach(UnaryFunc func, Execution execution = std::execution::seq) {
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            std::for_each(Base::begin(), Base::end(), std::move(func));
+            detail::forEach(Base::begin(), Base::end(), func);
+        }
+        else if constexpr (detail::IsPartitionable<Iterator>::value) {
+            detail::partitionedForEach(execution, Base::begin(), Base::end(), std::move(func));
         }
         else {
-            std::for_each(execution, Base::begin(), Base::end(), std::move(func));
+            detail::executeForEach(execution, Base::begin(), Base::end(), std::move(func));
         }
         return *this;
     }
@@ -465,12 +602,20 @@ public:
      */
     template<class T, class BinaryFunction, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T foldl(T&& init, BinaryFunction function, Execution execution = std::execution::seq) const {
-        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
+        if constexpr (detail::IsSequencedPolicyV<Execution> &&
+                      (detail::HasBatchedPull<Iterator>::value || detail::HasContiguousData<Iterator>::value)) {
+            static_cast<void>(execution);
+            return detail::accumulate(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+        }
+        else if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
             return std::reduce(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
+        else if constexpr (detail::IsPartitionable<Iterator>::value) {
+            return detail::partitionedFoldl(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+        }
         else {
-            return std::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            return detail::executeReduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
     }
 
@@ -489,18 +634,26 @@ public:
                                std::move(function));
         }
         else {
-            return std::reduce(execution, detail::begin(std::move(reverseView)), detail::end(std::move(reverseView)),
-                               std::forward<T>(init), std::move(function));
+            return detail::executeReduce(execution, detail::begin(std::move(reverseView)), detail::end(std::move(reverseView)),
+                                         std::forward<T>(init), std::move(function));
         }
     }
 
     /**
-     * Sums the sequence generated so far.
+     * Sums the sequence generated so far. Contiguous sequences of arithmetic values of at least the size of an `int` (or an
+     * `lz::as` of those) are summed with multiple accumulators, so the order in which floating point values are added is
+     * unspecified.
      * @param execution The execution policy.
      */
     template<class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 value_type sum(Execution execution = std::execution::seq) const {
-        return this->foldl(value_type(), std::plus<>(), execution);
+        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
+            static_cast<void>(execution);
+            return detail::sum(Base::begin(), Base::end());
+        }
+        else {
+            return this->foldl(value_type(), std::plus<>(), execution);
+        }
     }
 
     /**
@@ -514,10 +667,10 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+            return *detail::maxElement(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
-            return *std::max_element(execution, Base::begin(), Base::end(), std::move(cmp));
+            return *detail::executeMaxElement(execution, Base::begin(), Base::end(), std::move(cmp));
         }
     }
 
@@ -532,10 +685,32 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+            return *detail::minElement(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
-            return *std::min_element(execution, Base::begin(), Base::end(), std::move(cmp));
+            return *detail::executeMinElement(execution, Base::begin(), Base::end(), std::move(cmp));
+        }
+    }
+
+    /**
+     * Gets the min and the max value of the current iterator view, in one pass if the execution policy is sequenced. Both are the
+     * first of equal elements, like with `min` and `max`.
+     * @param cmp The comparer. operator< is assumed by default.
+     * @param execution The execution policy.
+     * @return A pair of the min and the max element.
+     */
+    template<class Compare = std::less<>, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::pair<reference, reference>
+    minMax(Compare cmp = {}, Execution execution = std::execution::seq) const {
+        LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min and max element");
+        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
+            static_cast<void>(execution);
+            auto elements = detail::minMaxElement(Base::begin(), Base::end(), std::move(cmp));
+            return { *elements.first, *elements.second };
+        }
+        else {
+            return { *detail::executeMinElement(execution, Base::begin(), Base::end(), cmp),
+                     *detail::executeMaxElement(execution, Base::begin(), Base::end(), cmp) };
         }
     }
 
@@ -561,10 +736,14 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool all(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+            return detail::allOf(Base::begin(), Base::end(), std::move(predicate));
+        }
+        else if constexpr (detail::IsPartitionable<Iterator>::value) {
+            return !detail::partitionedAnyOf(execution, Base::begin(), Base::end(),
+                                             [&predicate](const value_type& value) { return !predicate(value); });
         }
         else {
-            return std::all_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return detail::executeAllOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -578,10 +757,13 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool any(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+            return detail::anyOf(Base::begin(), Base::end(), std::move(predicate));
+        }
+        else if constexpr (detail::IsPartitionable<Iterator>::value) {
+            return detail::partitionedAnyOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::any_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return detail::executeAnyOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -595,10 +777,13 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool none(UnaryPredicate predicate, Execution execution = std::execution::seq) {
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+            return !detail::anyOf(Base::begin(), Base::end(), std::move(predicate));
+        }
+        else if constexpr (detail::IsPartitionable<Iterator>::value) {
+            return !detail::partitionedAnyOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::none_of(execution, Base::begin(), Base::end(), std::move(predicate));
+            return detail::executeNoneOf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -611,10 +796,10 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type count(const T& value, Execution execution = std::execution::seq) const {
         if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count(Base::begin(), Base::end(), value);
+            return detail::count(Base::begin(), Base::end(), value);
         }
         else {
-            return std::count(execution, Base::begin(), Base::end(), value);
+            return detail::executeCount(execution, Base::begin(), Base::end(), value);
         }
     }
 
@@ -631,7 +816,7 @@ public:
             return std::count_if(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::count_if(execution, Base::begin(), Base::end(), std::move(predicate));
+            return detail::executeCountIf(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
 
@@ -642,12 +827,12 @@ public:
      */
     template<class BinaryPredicate = std::less<>, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& sort(BinaryPredicate predicate = {}, Execution execution = std::execution::seq) {
-        if constexpr (detail::isCompatibleForExecution<Execution, IterView>()) {
+        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
             static_cast<void>(execution);
             std::sort(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            std::sort(execution, Base::begin(), Base::end(), std::move(predicate));
+            detail::executeSort(execution, Base::begin(), Base::end(), std::move(predicate));
         }
         return *this;
     }
@@ -665,24 +850,49 @@ public:
             return std::is_sorted(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
-            return std::is_sorted(execution, Base::begin(), Base::end(), std::move(predicate));
+            return detail::executeIsSorted(execution, Base::begin(), Base::end(), std::move(predicate));
         }
     }
+
 #else // ^^^ lz has execution vvv ! lz has execution
 
     //! See Filter.hpp for documentation
-    template<class UnaryPredicate>
-    IterView<detail::FilterIterator<Iterator, UnaryPredicate>> filter(UnaryPredicate predicate) const {
+    template<class UnaryPredicate, class I = Iterator>
+    detail::EnableIf<!detail::FilterFusion<I, UnaryPredicate>::value, IterView<detail::FilterIterator<Iterator, UnaryPredicate>>>
+    filter(UnaryPredicate predicate) const {
         return chain(lz::filter(*this, std::move(predicate)));
     }
 
-    //! See Except.hpp for documentation
+    //! See Filter.hpp for documentation. A filter of a filter is fused into one filter that tests both predicates, see
+    //! Fusion.hpp
+    template<class UnaryPredicate, class I = Iterator, class Fusion = detail::FilterFusion<I, UnaryPredicate>>
+    detail::EnableIf<Fusion::value, IterView<detail::FilterIterator<typename Fusion::BaseIterator, typename Fusion::Predicate>>>
+    filter(UnaryPredicate predicate) const {
+        return chain(lz::filterRange(this->begin().base(), this->end().base(),
+                                     typename Fusion::Predicate(this->begin().predicate(), std::move(predicate))));
+    }
+
+    //! See Except.hpp for documentation.
     template<class IterableToExcept, class Compare = std::less<value_type>>
     IterView<detail::ExceptIterator<Iterator, detail::IterTypeFromIterable<IterableToExcept>, Compare>>
     except(IterableToExcept&& toExcept, Compare compare = {}) const {
         return chain(lz::except(*this, toExcept, std::move(compare)));
     }
 
+    //! See Except.hpp for documentation.
+    template<class IterableToExcept>
+    IterView<detail::HashExceptIterator<Iterator, detail::IterTypeFromIterable<IterableToExcept>>>
+    hashExcept(IterableToExcept&& toExcept) const {
+        return chain(lz::hashExcept(*this, toExcept));
+    }
+
+    //! See Except.hpp for documentation
+    template<class IterableToExcept>
+    IterView<detail::HashExceptIterator<Iterator, detail::IterTypeFromIterable<IterableToExcept>>>
+    hashExcept(IterableToExcept&& toExcept, const SortedTag tag) const {
+        return chain(lz::hashExcept(*this, toExcept, tag));
+    }
+
     //! See Unique.hpp for documentation
     template<class Compare = std::less<value_type>>
     IterView<detail::UniqueIterator<Iterator, Compare>> unique(Compare compare = {}) const {
@@ -717,6 +927,14 @@ public:
         return chain(lz::joinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
     }
 
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    IterView<detail::HashJoinWhereIterator<Iterator, detail::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                                           ResultSelector>>
+    hashJoinWhere(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return chain(lz::hashJoinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
     //! See Take.hpp for documentation
     template<class UnaryPredicate>
     IterView<Iterator> dropWhile(UnaryPredicate predicate) const {
@@ -825,7 +1043,7 @@ public:
      */
     template<class UnaryFunc>
     IterView<Iterator>& forEach(UnaryFunc func) {
-        std::for_each(Base::begin(), Base::end(), std::move(func));
+        detail::forEach(Base::begin(), Base::end(), func);
         return *this;
     }
 
@@ -854,14 +1072,12 @@ public:
     }
 
     /**
-     * Sums the sequence generated so far.
+     * Sums the sequence generated so far. Contiguous sequences of arithmetic values of at least the size of an `int` (or an
+     * `lz::as` of those) are summed with multiple accumulators, so the order in which floating point values are added is
+     * unspecified.
      */
     value_type sum() const {
-#ifdef LZ_HAS_CXX_11
-        return this->foldl(value_type(), [](value_type init, const value_type& val) { return std::move(init) + val; });
-#else
-        return this->foldl(value_type(), std::plus<>());
-#endif // LZ_HAS_CXX_11
+        return detail::sum(Base::begin(), Base::end());
     }
 
     /**
@@ -872,7 +1088,7 @@ public:
     template<class Compare = MAKE_BIN_OP(std::less, value_type)>
     reference max(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
-        return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+        return *detail::maxElement(Base::begin(), Base::end(), std::move(cmp));
     }
 
     /**
@@ -883,7 +1099,20 @@ public:
     template<class Compare = MAKE_BIN_OP(std::less, value_type)>
     reference min(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
-        return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+        return *detail::minElement(Base::begin(), Base::end(), std::move(cmp));
+    }
+
+    /**
+     * Gets the min and the max value of the current iterator view in one pass. Both are the first of equal elements, like with
+     * `min` and `max`.
+     * @param cmp The comparer. operator< is assumed by default.
+     * @return A pair of the min and the max element.
+     */
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    std::pair<reference, reference> minMax(Compare cmp = {}) const {
+        LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min and max element");
+        auto elements = detail::minMaxElement(Base::begin(), Base::end(), std::move(cmp));
+        return { *elements.first, *elements.second };
     }
 
     //! See FunctionTools.hpp for documentation
@@ -905,7 +1134,7 @@ public:
      */
     template<class UnaryPredicate>
     bool all(UnaryPredicate predicate) const {
-        return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+        return detail::allOf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -915,7 +1144,7 @@ public:
      */
     template<class UnaryPredicate>
     bool any(UnaryPredicate predicate) const {
-        return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+        return detail::anyOf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -925,7 +1154,7 @@ public:
      */
     template<class UnaryPredicate>
     bool none(UnaryPredicate predicate) const {
-        return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+        return !detail::anyOf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -935,7 +1164,7 @@ public:
      */
     template<class T>
     difference_type count(const T& value) const {
-        return std::count(Base::begin(), Base::end(), value);
+        return detail::count(Base::begin(), Base::end(), value);
     }
 
     /**
@@ -17,7 +17,7 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
-    LZ_CONSTEXPR_CXX_20 Map(Iterator begin, Iterator end, Function function) :
+    LZ_CONSTEXPR_CXX_20 Map(Iterator begin, Iterator end, detail::FunctionStorage<Function> function) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), function), iterator(std::move(end), function)) {
     }
 
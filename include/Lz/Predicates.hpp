@@ -0,0 +1,157 @@
+#pragma once
+
+#ifndef LZ_PREDICATES_HPP
+#define LZ_PREDICATES_HPP
+
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <utility>
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * Predicates of which the comparison is known, instead of hidden inside a lambda. They can be used anywhere a unary predicate
+ * is expected, but `lz::filter` over a contiguous range of `float`, `double` or `int32_t` evaluates them with SIMD instructions
+ * when the filter is materialized (e.g. with `to`, `copyTo` or `distance`). I.e.
+ * `lz::filter(floats, lz::pred::gt(0.f) && lz::pred::lt(1.f))`. Only comparisons against a value of the exact same type as the
+ * elements are vectorized, so use `lt(1.f)` rather than `lt(1.0)` for floats.
+ */
+namespace pred {
+enum class CompareOp { Less, LessEqual, Greater, GreaterEqual, Equal, NotEqual };
+
+// Base of all predicates in this namespace, used to enable `&&` and `||`
+struct PredicateBase {};
+
+template<CompareOp Op, class T>
+struct Compare : PredicateBase {
+    T value{};
+
+    constexpr Compare() = default;
+
+    constexpr explicit Compare(T v) : value(std::move(v)) {
+    }
+
+    template<class U>
+    constexpr bool operator()(const U& element) const {
+        return Op == CompareOp::Less           ? element < value
+               : Op == CompareOp::LessEqual    ? element <= value
+               : Op == CompareOp::Greater      ? element > value
+               : Op == CompareOp::GreaterEqual ? element >= value
+               : Op == CompareOp::Equal        ? element == value
+                                               : element != value;
+    }
+};
+
+// Inclusive on both sides
+template<class T>
+struct Between : PredicateBase {
+    T low{};
+    T high{};
+
+    constexpr Between() = default;
+
+    constexpr Between(T l, T h) : low(std::move(l)), high(std::move(h)) {
+    }
+
+    template<class U>
+    constexpr bool operator()(const U& element) const {
+        return low <= element && element <= high;
+    }
+};
+
+template<class Left, class Right>
+struct And : PredicateBase {
+    Left left{};
+    Right right{};
+
+    constexpr And() = default;
+
+    constexpr And(Left l, Right r) : left(std::move(l)), right(std::move(r)) {
+    }
+
+    template<class U>
+    constexpr bool operator()(const U& element) const {
+        return left(element) && right(element);
+    }
+};
+
+template<class Left, class Right>
+struct Or : PredicateBase {
+    Left left{};
+    Right right{};
+
+    constexpr Or() = default;
+
+    constexpr Or(Left l, Right r) : left(std::move(l)), right(std::move(r)) {
+    }
+
+    template<class U>
+    constexpr bool operator()(const U& element) const {
+        return left(element) || right(element);
+    }
+};
+
+template<class T>
+struct IsPredicate : std::is_base_of<PredicateBase, T> {};
+
+//! Returns a predicate that is true for elements `< value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::Less, T> lt(T value) {
+    return Compare<CompareOp::Less, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements `<= value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::LessEqual, T> le(T value) {
+    return Compare<CompareOp::LessEqual, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements `> value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::Greater, T> gt(T value) {
+    return Compare<CompareOp::Greater, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements `>= value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::GreaterEqual, T> ge(T value) {
+    return Compare<CompareOp::GreaterEqual, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements `== value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::Equal, T> eq(T value) {
+    return Compare<CompareOp::Equal, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements `!= value`
+template<class T>
+LZ_NODISCARD constexpr Compare<CompareOp::NotEqual, T> ne(T value) {
+    return Compare<CompareOp::NotEqual, T>(std::move(value));
+}
+
+//! Returns a predicate that is true for elements in [low, high]
+template<class T>
+LZ_NODISCARD constexpr Between<T> between(T low, T high) {
+    return Between<T>(std::move(low), std::move(high));
+}
+
+template<class Left, class Right, class = detail::EnableIf<IsPredicate<Left>::value && IsPredicate<Right>::value>>
+LZ_NODISCARD constexpr And<Left, Right> operator&&(Left left, Right right) {
+    return And<Left, Right>(std::move(left), std::move(right));
+}
+
+template<class Left, class Right, class = detail::EnableIf<IsPredicate<Left>::value && IsPredicate<Right>::value>>
+LZ_NODISCARD constexpr Or<Left, Right> operator||(Left left, Right right) {
+    return Or<Left, Right>(std::move(left), std::move(right));
+}
+} // namespace pred
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_PREDICATES_HPP
@@ -18,7 +18,7 @@ public:
 
     constexpr TakeWhile() = default;
 
-    constexpr TakeWhile(Iterator begin, Iterator end, UnaryPredicate predicate) :
+    constexpr TakeWhile(Iterator begin, Iterator end, detail::FunctionStorage<UnaryPredicate> predicate) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, predicate), iterator(end, end, predicate)) {
     }
 };
@@ -74,7 +74,7 @@ dropWhileRange(Iterator begin, Iterator end, UnaryPredicate predicate, Execution
         begin = std::find_if_not(std::move(begin), end, std::move(predicate));
     }
     else {
-        begin = std::find_if_not(execution, std::move(begin), end, std::move(predicate));
+        begin = detail::executeFindIfNot(execution, begin, end, std::move(predicate));
     }
     return { std::move(begin), std::move(end) };
 }
@@ -27,11 +27,11 @@ public:
     using value_type = typename iterator::value_type;
 
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 Unique(Iterator begin, Iterator end, Compare compare, Execution e) :
+    LZ_CONSTEXPR_CXX_20 Unique(Iterator begin, Iterator end, detail::FunctionStorage<Compare> compare, Execution e) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, compare, e), iterator(end, end, compare, e)) {
     }
 #else
-    Unique(Iterator begin, Iterator end, Compare compare) :
+    Unique(Iterator begin, Iterator end, detail::FunctionStorage<Compare> compare) :
         detail::BasicIteratorView<iterator>(iterator(std::move(begin), end, compare), iterator(end, end, compare)) {
     }
 #endif
@@ -53,7 +53,7 @@ public:
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param execPolicy The execution policy. Must be one of `std::execution`'s tags. Finding the adjacent
- * element are done using this policy.
+ * element is sequential; pass the policy to the terminal operation instead.
  * @param sortFunc (Optional) to find adjacent elements.
  * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
  */
@@ -70,7 +70,7 @@ uniqueRange(Iterator begin, Iterator end, Compare compare = {}, Execution execPo
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param execPolicy The execution policy. Must be one of `std::execution`'s tags. Finding the adjacent
- * element are done using this policy.
+ * element is sequential; pass the policy to the terminal operation instead.
  * @param sortFunc (Optional) to find adjacent elements.
  * @return An Unique iterator view object, which can be used to iterate over in a `(for ... : uniqueRange(...))` fashion.
  */
@@ -10,8 +10,7 @@ namespace lz {
 namespace detail {
 template<class Tuple, std::size_t... Is>
 Tuple createEndSmallestIterator(const Tuple& begin, Tuple end, IndexSequence<Is...>) {
-    const std::ptrdiff_t lengths[] = { static_cast<std::ptrdiff_t>(
-        lz::detail::sizeHint(std::get<Is>(begin), std::get<Is>(end)))... };
+    const std::ptrdiff_t lengths[] = { static_cast<std::ptrdiff_t>(getSizeHint(std::get<Is>(begin), std::get<Is>(end)).size)... };
     const auto smallestLength = *std::min_element(std::begin(lengths), std::end(lengths));
     // If we use begin + smallestLength, we get compile errors for non random access iterators. However, we know that we are
     // dealing with a random access iterator, so std::next does a + internally. It is implemented this way to prevent more
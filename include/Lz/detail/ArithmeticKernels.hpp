@@ -0,0 +1,462 @@
+#pragma once
+
+#ifndef LZ_ARITHMETIC_KERNELS_HPP
+#define LZ_ARITHMETIC_KERNELS_HPP
+
+#include "Lz/detail/BatchedIteration.hpp"
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/Simd.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace lz {
+namespace detail {
+template<class To>
+struct ConvertFn;
+
+template<class Iterator, class Function>
+class MapIterator;
+
+// Smaller integers are promoted to int by every operation, so the kernels below only handle int and wider
+template<class T, bool = std::is_integral<T>::value && !std::is_same<T, bool>::value>
+struct IsKernelArithmetic : std::is_floating_point<T> {};
+
+template<class T>
+struct IsKernelArithmetic<T, true> : std::integral_constant<bool, sizeof(T) >= sizeof(int)> {};
+
+/**
+ * Sequences of arithmetic values that are stored in contiguous memory, which the kernels below can loop over with a plain index.
+ * A source has a type `Value`, which is the value type of the iterator, and a static member function
+ * `const Element* data(const Iterator& begin, const Iterator& end, std::size_t& size)` that returns the first element of
+ * [begin, end) and sets `size` if the range is contiguous and not empty, and null otherwise. Every element is read as
+ * `static_cast<Value>(element)`, so that a `lz::as<double>` over a vector of `int`s is a source as well.
+ */
+template<class Iterator, class = void>
+struct ArithmeticSource : std::false_type {};
+
+template<class Iterator>
+struct ArithmeticSource<Iterator, EnableIf<IsContiguousIterator<Iterator>::value && !HasContiguousData<Iterator>::value &&
+                                           IsKernelArithmetic<ValueType<Iterator>>::value>> : std::true_type {
+    using Value = ValueType<Iterator>;
+
+    static const Value* data(const Iterator& begin, const Iterator& end, std::size_t& size) {
+        if (begin == end) {
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(end - begin);
+        return std::addressof(*begin);
+    }
+};
+
+template<class Iterator>
+struct ArithmeticSource<Iterator, EnableIf<HasContiguousData<Iterator>::value && IsKernelArithmetic<ValueType<Iterator>>::value &&
+                                           IsKernelArithmetic<Decay<typename Iterator::ContiguousElement>>::value>>
+    : std::true_type {
+    using Value = ValueType<Iterator>;
+
+    static const typename Iterator::ContiguousElement* data(const Iterator& begin, const Iterator& end, std::size_t& size) {
+        return begin.contiguousData(end, size);
+    }
+};
+
+template<class Iterator, class To>
+struct ArithmeticSource<MapIterator<Iterator, ConvertFn<To>>,
+                        EnableIf<ArithmeticSource<Iterator>::value && IsKernelArithmetic<To>::value>> : std::true_type {
+    using Value = To;
+
+    static auto data(const MapIterator<Iterator, ConvertFn<To>>& begin, const MapIterator<Iterator, ConvertFn<To>>& end,
+                     std::size_t& size) -> decltype(ArithmeticSource<Iterator>::data(begin.base(), end.base(), size)) {
+        return ArithmeticSource<Iterator>::data(begin.base(), end.base(), size);
+    }
+};
+
+template<class Compare, class T>
+struct IsLess : std::is_same<Compare, std::less<T>> {};
+
+template<class BinaryOp, class T>
+struct IsPlus : std::is_same<BinaryOp, std::plus<T>> {};
+
+#ifndef LZ_HAS_CXX_11
+template<class T>
+struct IsLess<std::less<>, T> : std::true_type {};
+
+template<class T>
+struct IsPlus<std::plus<>, T> : std::true_type {};
+#endif // LZ_HAS_CXX_11
+
+// The amount of independent accumulators of the kernels below. Every iteration of their inner loop updates every accumulator
+// once, without waiting on the result of the previous iteration, so that the compiler can keep them in one or two vector
+// registers
+constexpr std::size_t KernelLanes = 8;
+
+/**
+ * Compilers do not vectorize floating point sums, mins and maxes by themselves, because vectorizing them changes the order of the
+ * additions, or (for `a < b ? a : b`) is only allowed if NaN and -0.0 are ignored. `minps`/`minpd` return their second operand if
+ * either operand is NaN, which is exactly `a < b ? a : b`, so floats and doubles are handled with `SimdOps` instead: AVX2 if it
+ * is enabled, SSE2 otherwise, which every x64 processor has.
+ */
+template<class Accumulator, class Value, class Element>
+struct UseSimd
+    : std::integral_constant<bool, (std::is_same<Value, float>::value || std::is_same<Value, double>::value) &&
+                                       std::is_same<Accumulator, Value>::value && std::is_same<Decay<Element>, Value>::value> {};
+
+// Floating point additions are not associative, so the compiler does not split a sum in multiple accumulators by itself
+template<class Accumulator, class Value, class Element>
+#ifdef LZ_HAS_SIMD
+EnableIf<!UseSimd<Accumulator, Value, Element>::value, Accumulator>
+#else
+Accumulator
+#endif // LZ_HAS_SIMD
+sumKernel(const Element* data, const std::size_t size) {
+    Accumulator lanes[KernelLanes] = {};
+    std::size_t i = 0;
+    for (; i + KernelLanes <= size; i += KernelLanes) {
+        for (std::size_t lane = 0; lane < KernelLanes; ++lane) {
+            lanes[lane] = static_cast<Accumulator>(lanes[lane] + static_cast<Accumulator>(static_cast<Value>(data[i + lane])));
+        }
+    }
+    for (; i < size; ++i) {
+        lanes[0] = static_cast<Accumulator>(lanes[0] + static_cast<Accumulator>(static_cast<Value>(data[i])));
+    }
+    for (std::size_t width = KernelLanes / 2; width > 0; width /= 2) {
+        for (std::size_t lane = 0; lane < width; ++lane) {
+            lanes[lane] = static_cast<Accumulator>(lanes[lane] + lanes[lane + width]);
+        }
+    }
+    return lanes[0];
+}
+
+#ifdef LZ_HAS_SIMD
+// The registers are written out, so that they are kept in registers without the compiler having to unroll a loop over them
+template<class Accumulator, class Value, class Element>
+EnableIf<UseSimd<Accumulator, Value, Element>::value, Accumulator> sumKernel(const Element* data, const std::size_t size) {
+    using Simd = SimdOps<Value>;
+    constexpr std::size_t Width = Simd::Width;
+    auto sum0 = Simd::broadcast(0);
+    auto sum1 = sum0;
+    auto sum2 = sum0;
+    auto sum3 = sum0;
+    std::size_t i = 0;
+    for (; i + 4 * Width <= size; i += 4 * Width) {
+        sum0 = Simd::add(sum0, Simd::load(data + i));
+        sum1 = Simd::add(sum1, Simd::load(data + i + Width));
+        sum2 = Simd::add(sum2, Simd::load(data + i + 2 * Width));
+        sum3 = Simd::add(sum3, Simd::load(data + i + 3 * Width));
+    }
+
+    Value lanes[Width];
+    Simd::store(lanes, Simd::add(Simd::add(sum0, sum1), Simd::add(sum2, sum3)));
+    for (; i < size; ++i) {
+        lanes[0] += data[i];
+    }
+    return std::accumulate(std::begin(lanes), std::end(lanes), Value{ 0 });
+}
+#endif // LZ_HAS_SIMD
+
+// Compares in the common type explicitly, which is what `element == value` does implicitly. The lanes are 32 bit, so that they
+// fit as many in a vector register as 32 bit elements do, and are added to the total before they can overflow
+template<class Value, class Element, class T>
+std::size_t countKernel(const Element* data, const std::size_t size, const T& value) {
+    using Common = typename std::common_type<Value, T>::type;
+    constexpr std::size_t MaxIterations = (std::numeric_limits<std::uint32_t>::max)();
+    const auto target = static_cast<Common>(value);
+    std::size_t total = 0;
+    std::size_t i = 0;
+    while (i + KernelLanes <= size) {
+        const std::size_t blockEnd = i + (std::min)((size - i) / KernelLanes, MaxIterations) * KernelLanes;
+        std::uint32_t lanes[KernelLanes] = {};
+        for (; i < blockEnd; i += KernelLanes) {
+            for (std::size_t lane = 0; lane < KernelLanes; ++lane) {
+                lanes[lane] += static_cast<std::uint32_t>(static_cast<Common>(static_cast<Value>(data[i + lane])) == target);
+            }
+        }
+        total = std::accumulate(std::begin(lanes), std::end(lanes), total);
+    }
+    for (; i < size; ++i) {
+        total += static_cast<std::size_t>(static_cast<Common>(static_cast<Value>(data[i])) == target);
+    }
+    return total;
+}
+
+#ifdef LZ_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#endif // LZ_MSVC
+
+/**
+ * Returns the smallest and the largest value of the non empty range `data`, as `std::min_element` and `std::max_element` with
+ * `operator<` would select them. Only the values that are asked for are computed, the others are `data[0]`. Every lane starts at
+ * the first element, so like with `std::min_element`, NaN is only the result if the first element is NaN.
+ */
+template<bool FindMin, bool FindMax, class Value, class Element>
+#ifdef LZ_HAS_SIMD
+EnableIf<!UseSimd<Value, Value, Element>::value, std::pair<Value, Value>>
+#else
+std::pair<Value, Value>
+#endif // LZ_HAS_SIMD
+minMaxKernel(const Element* data, const std::size_t size) {
+    const auto first = static_cast<Value>(data[0]);
+    Value low[KernelLanes];
+    Value high[KernelLanes];
+    std::fill(std::begin(low), std::end(low), first);
+    std::fill(std::begin(high), std::end(high), first);
+
+    std::size_t i = 0;
+    for (; i + KernelLanes <= size; i += KernelLanes) {
+        for (std::size_t lane = 0; lane < KernelLanes; ++lane) {
+            const auto value = static_cast<Value>(data[i + lane]);
+            if (FindMin) {
+                low[lane] = value < low[lane] ? value : low[lane];
+            }
+            if (FindMax) {
+                high[lane] = high[lane] < value ? value : high[lane];
+            }
+        }
+    }
+    for (; i < size; ++i) {
+        const auto value = static_cast<Value>(data[i]);
+        if (FindMin) {
+            low[0] = value < low[0] ? value : low[0];
+        }
+        if (FindMax) {
+            high[0] = high[0] < value ? value : high[0];
+        }
+    }
+    for (std::size_t lane = 1; lane < KernelLanes; ++lane) {
+        low[0] = low[lane] < low[0] ? low[lane] : low[0];
+        high[0] = high[0] < high[lane] ? high[lane] : high[0];
+    }
+    return { low[0], high[0] };
+}
+
+#ifdef LZ_HAS_SIMD
+template<bool FindMin, bool FindMax, class Value, class Element>
+EnableIf<UseSimd<Value, Value, Element>::value, std::pair<Value, Value>>
+minMaxKernel(const Element* data, const std::size_t size) {
+    using Simd = SimdOps<Value>;
+    constexpr std::size_t Width = Simd::Width;
+    auto low0 = Simd::broadcast(data[0]);
+    auto low1 = low0;
+    auto low2 = low0;
+    auto low3 = low0;
+    auto high0 = low0;
+    auto high1 = low0;
+    auto high2 = low0;
+    auto high3 = low0;
+    std::size_t i = 0;
+    for (; i + 4 * Width <= size; i += 4 * Width) {
+        const auto value0 = Simd::load(data + i);
+        const auto value1 = Simd::load(data + i + Width);
+        const auto value2 = Simd::load(data + i + 2 * Width);
+        const auto value3 = Simd::load(data + i + 3 * Width);
+        if (FindMin) {
+            low0 = Simd::min(value0, low0);
+            low1 = Simd::min(value1, low1);
+            low2 = Simd::min(value2, low2);
+            low3 = Simd::min(value3, low3);
+        }
+        if (FindMax) {
+            high0 = Simd::max(value0, high0);
+            high1 = Simd::max(value1, high1);
+            high2 = Simd::max(value2, high2);
+            high3 = Simd::max(value3, high3);
+        }
+    }
+
+    Value low[Width];
+    Value high[Width];
+    Simd::store(low, Simd::min(Simd::min(low3, low2), Simd::min(low1, low0)));
+    Simd::store(high, Simd::max(Simd::max(high3, high2), Simd::max(high1, high0)));
+    for (; i < size; ++i) {
+        if (FindMin) {
+            low[0] = data[i] < low[0] ? data[i] : low[0];
+        }
+        if (FindMax) {
+            high[0] = high[0] < data[i] ? data[i] : high[0];
+        }
+    }
+    for (std::size_t lane = 1; lane < Width; ++lane) {
+        low[0] = low[lane] < low[0] ? low[lane] : low[0];
+        high[0] = high[0] < high[lane] ? high[lane] : high[0];
+    }
+    return { low[0], high[0] };
+}
+#endif // LZ_HAS_SIMD
+
+#ifdef LZ_MSVC
+#pragma warning(pop)
+#endif // LZ_MSVC
+
+// The index of the first element that is equal to `value`, which is an element of `data`. Only the first element can be NaN
+// here, see `minMaxKernel`
+template<class Value, class Element>
+std::size_t indexOfKernel(const Element* data, const std::size_t size, const Value value) {
+    if (value != value) {
+        return 0;
+    }
+    std::size_t i = 0;
+    while (i < size && static_cast<Value>(data[i]) != value) {
+        ++i;
+    }
+    return i;
+}
+
+template<class Iterator>
+struct UseSumKernel : ArithmeticSource<Iterator> {};
+
+template<class Iterator, class T>
+struct UseCountKernel : std::integral_constant<bool, ArithmeticSource<Iterator>::value && std::is_arithmetic<T>::value> {};
+
+// The kernel returns a value, which is turned back into an iterator using its index
+template<class Iterator, class Compare>
+struct UseMinMaxKernel : std::integral_constant<bool, ArithmeticSource<Iterator>::value && IsRandomAccess<Iterator>::value &&
+                                                          IsLess<Compare, ValueType<Iterator>>::value> {};
+
+template<class Iterator, class BinaryOp>
+struct UseMeanKernel
+    : std::integral_constant<bool, ArithmeticSource<Iterator>::value && IsPlus<BinaryOp, ValueType<Iterator>>::value> {};
+
+// Returns the sum of [begin, end), starting at `ValueType<Iterator>()`
+template<class Iterator>
+EnableIf<!UseSumKernel<Iterator>::value, ValueType<Iterator>> sum(const Iterator& begin, const Iterator& end) {
+    using T = ValueType<Iterator>;
+    return detail::accumulate(begin, end, T(), MAKE_BIN_OP(std::plus, T)());
+}
+
+template<class Iterator>
+EnableIf<UseSumKernel<Iterator>::value, ValueType<Iterator>> sum(const Iterator& begin, const Iterator& end) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        return sumKernel<Value, Value>(data, size);
+    }
+    return detail::accumulate(begin, end, Value(), MAKE_BIN_OP(std::plus, Value)());
+}
+
+template<class Iterator, class T>
+EnableIf<!UseCountKernel<Iterator, T>::value, DiffType<Iterator>>
+count(const Iterator& begin, const Iterator& end, const T& value) {
+    return std::count(begin, end, value);
+}
+
+template<class Iterator, class T>
+EnableIf<UseCountKernel<Iterator, T>::value, DiffType<Iterator>>
+count(const Iterator& begin, const Iterator& end, const T& value) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        return static_cast<DiffType<Iterator>>(countKernel<Value>(data, size, value));
+    }
+    return std::count(begin, end, value);
+}
+
+template<class Iterator, class Compare>
+EnableIf<!UseMinMaxKernel<Iterator, Compare>::value, Iterator>
+minElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    return std::min_element(begin, end, std::move(compare));
+}
+
+template<class Iterator, class Compare>
+EnableIf<UseMinMaxKernel<Iterator, Compare>::value, Iterator>
+minElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        const auto low = minMaxKernel<true, false, Value>(data, size).first;
+        return begin + static_cast<DiffType<Iterator>>(indexOfKernel(data, size, low));
+    }
+    return std::min_element(begin, end, std::move(compare));
+}
+
+template<class Iterator, class Compare>
+EnableIf<!UseMinMaxKernel<Iterator, Compare>::value, Iterator>
+maxElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    return std::max_element(begin, end, std::move(compare));
+}
+
+template<class Iterator, class Compare>
+EnableIf<UseMinMaxKernel<Iterator, Compare>::value, Iterator>
+maxElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        const auto high = minMaxKernel<false, true, Value>(data, size).second;
+        return begin + static_cast<DiffType<Iterator>>(indexOfKernel(data, size, high));
+    }
+    return std::max_element(begin, end, std::move(compare));
+}
+
+/**
+ * Returns the first smallest and the first largest element of [begin, end) in one pass, or `end` twice if it is empty. Unlike
+ * `std::minmax_element`, which returns the last largest element, both are selected like `std::min_element` and
+ * `std::max_element` select them.
+ */
+template<class Iterator, class Compare>
+EnableIf<!UseMinMaxKernel<Iterator, Compare>::value, std::pair<Iterator, Iterator>>
+minMaxElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    if (begin == end) {
+        return { end, end };
+    }
+    Iterator low = begin;
+    Iterator high = begin;
+    for (Iterator it = std::next(begin); it != end; ++it) {
+        if (compare(*it, *low)) {
+            low = it;
+        }
+        else if (compare(*high, *it)) {
+            high = it;
+        }
+    }
+    return { std::move(low), std::move(high) };
+}
+
+template<class Iterator, class Compare>
+EnableIf<UseMinMaxKernel<Iterator, Compare>::value, std::pair<Iterator, Iterator>>
+minMaxElement(const Iterator& begin, const Iterator& end, Compare compare) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    using Diff = DiffType<Iterator>;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        const auto values = minMaxKernel<true, true, Value>(data, size);
+        return { begin + static_cast<Diff>(indexOfKernel(data, size, values.first)),
+                 begin + static_cast<Diff>(indexOfKernel(data, size, values.second)) };
+    }
+    return { std::min_element(begin, end, compare), std::max_element(begin, end, compare) };
+}
+
+template<class Iterator, class BinaryOp>
+EnableIf<!UseMeanKernel<Iterator, BinaryOp>::value, double>
+mean(const Iterator& begin, const Iterator& end, BinaryOp binaryOp) {
+    using T = ValueType<Iterator>;
+    const T total = std::accumulate(begin, end, T{ 0 }, std::move(binaryOp));
+    return static_cast<double>(total) / static_cast<double>(static_cast<std::size_t>(std::distance(begin, end)));
+}
+
+// Sums in double, or in a 64 bit integer for integers, instead of in the value type, so that the sum does not overflow
+template<class Iterator, class BinaryOp>
+EnableIf<UseMeanKernel<Iterator, BinaryOp>::value, double>
+mean(const Iterator& begin, const Iterator& end, BinaryOp binaryOp) {
+    using Value = typename ArithmeticSource<Iterator>::Value;
+    using Accumulator = Conditional<std::is_floating_point<Value>::value, double,
+                                    Conditional<std::is_signed<Value>::value, long long, unsigned long long>>;
+    std::size_t size = 0;
+    if (const auto* data = ArithmeticSource<Iterator>::data(begin, end, size)) {
+        return static_cast<double>(sumKernel<Accumulator, Value>(data, size)) / static_cast<double>(size);
+    }
+    const Value total = std::accumulate(begin, end, Value{ 0 }, std::move(binaryOp));
+    return static_cast<double>(total) / static_cast<double>(static_cast<std::size_t>(std::distance(begin, end)));
+}
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_ARITHMETIC_KERNELS_HPP
@@ -4,9 +4,12 @@
 #define LZ_BASIC_ITERATOR_VIEW_HPP
 
 #include "Lz/StringView.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/Concepts.hpp"
+#include "Lz/detail/Parallel.hpp"
 #include "Lz/detail/Procs.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 #include <algorithm>
@@ -179,9 +182,9 @@ doMakeString(const Iterator& b, const Iterator& e, const StringView delimiter) {
     }
     std::string result;
 
-    const auto len = static_cast<std::size_t>(sizeHint(b, e));
-    if (len != 0) {
-        result.reserve(len + delimiter.size() * len + 1);
+    const std::size_t size = reserveSize(getSizeHint(b, e));
+    if (size != 0) {
+        result.reserve(size + delimiter.size() * size + 1);
     }
 
 #if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
@@ -220,6 +223,17 @@ struct HasReserve : std::false_type {};
 template<class T>
 struct HasReserve<T, decltype((void)std::declval<T&>().reserve(1), 0)> : std::true_type {};
 
+// Containers such as std::vector, std::deque and std::string, that can append a whole range at once
+template<class T, class = int>
+struct IsAppendable : std::false_type {};
+
+template<class T>
+struct IsAppendable<T, decltype((void)std::declval<T&>().insert(std::declval<T&>().end(),
+                                                                 std::declval<const typename T::value_type*>(),
+                                                                 std::declval<const typename T::value_type*>()),
+                                (void)std::declval<T&>().push_back(std::declval<const typename T::value_type&>()), 0)>
+    : std::true_type {};
+
 template<class It>
 class BasicIteratorView {
 protected:
@@ -238,19 +252,52 @@ private:
     using KeyType = FunctionReturnType<KeySelectorFunc, RefType<It>>;
 
 #ifndef __cpp_if_constexpr
+    template<class Container>
+    EnableIf<!IsAppendable<Container>::value, void> insertInto(Container& container) const {
+        copyTo(std::inserter(container, container.begin()));
+    }
+
+    // Contiguous sources are copied into the container at once, other sources are pushed back
+    template<class Container>
+    EnableIf<IsAppendable<Container>::value, void> insertInto(Container& container) const {
+        if (container.empty()) {
+            appendTo(container, _begin, _end);
+            return;
+        }
+        copyTo(std::inserter(container, container.begin()));
+    }
+
     template<class Container>
     EnableIf<!HasReserve<Container>::value, void> tryReserve(Container&) const {
     }
 
     template<class Container>
     EnableIf<HasReserve<Container>::value, void> tryReserve(Container& container) const {
-        container.reserve(static_cast<std::size_t>(sizeHint(_begin, _end)));
+        const std::size_t size = reserveSize(getSizeHint(_begin, _end));
+        if (size != 0) {
+            container.reserve(size);
+        }
     }
 #else
+    template<class Container>
+    LZ_CONSTEXPR_CXX_20 void insertInto(Container& container) const {
+        // Contiguous sources are copied into the container at once, other sources are pushed back
+        if constexpr (IsAppendable<Container>::value) {
+            if (container.empty()) {
+                appendTo(container, _begin, _end);
+                return;
+            }
+        }
+        copyTo(std::inserter(container, container.begin()));
+    }
+
     template<class Container>
     LZ_CONSTEXPR_CXX_20 void tryReserve(Container& container) const {
         if constexpr (HasReserve<Container>::value) {
-            container.reserve(static_cast<std::size_t>(sizeHint(_begin, _end)));
+            const std::size_t size = reserveSize(getSizeHint(_begin, _end));
+            if (size != 0) {
+                container.reserve(size);
+            }
         }
     }
 #endif // __cpp_if_constexpr
@@ -348,7 +395,11 @@ public:
         Container container(std::forward<Args>(args)...);
         tryReserve(container);
         if constexpr (detail::IsSequencedPolicyV<Execution>) {
-            copyTo(std::inserter(container, container.begin()), execution);
+            static_cast<void>(execution);
+            insertInto(container);
+        }
+        else if constexpr (detail::IsPartitionable<It>::value) {
+            detail::partitionedCopy(execution, _begin, _end, std::inserter(container, container.begin()));
         }
         else {
             static_assert(HasResize<Container>::value, "Container needs to have a method resize() in order to use parallel"
@@ -365,17 +416,22 @@ public:
      * Fills destination output iterator `outputIterator` with current contents of [`begin()`, `end()`).
      * @param outputIterator The output to fill into. Essentially the same as:
      * `std::copy(lzView.begin(), lzView.end(), myContainer.begin());`
-     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags. If the view is not random access but its
+     * underlying range can be split (e.g. a filter over a vector), the view is split once in multiple parts that are copied
+     * in parallel, after which the results are written to `outputIterator` in order.
      */
     template<class OutputIterator, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator, Execution execution = std::execution::seq) const {
-        if constexpr (detail::isCompatibleForExecution<Execution, OutputIterator>()) {
-            std::copy(_begin, _end, outputIterator);
+        if constexpr (!detail::IsSequencedPolicyV<Execution> && detail::IsPartitionable<It>::value) {
+            detail::partitionedCopy(execution, _begin, _end, std::move(outputIterator));
+        }
+        else if constexpr (detail::isCompatibleForExecution<Execution, OutputIterator>()) {
+            detail::copy(_begin, _end, std::move(outputIterator));
         }
         else {
             static_assert(IsForward<It>::value,
                           "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-            std::copy(execution, _begin, _end, outputIterator);
+            detail::executeCopy(execution, _begin, _end, std::move(outputIterator));
         }
     }
 
@@ -396,7 +452,8 @@ public:
             static_assert(IsForward<It>::value, "Iterator type must be at least forward to use parallel execution");
             static_assert(IsForward<OutputIterator>::value,
                           "Output iterator type must be at least forward to use parallel execution");
-            std::transform(execution, _begin, _end, outputIterator, std::forward<TransformFunc>(transformFunc));
+            detail::executeTransform(execution, _begin, _end, std::move(outputIterator),
+                                     std::forward<TransformFunc>(transformFunc));
         }
     }
     
@@ -495,7 +552,7 @@ public:
     Container to(Args&&... args) const {
         Container cont(std::forward<Args>(args)...);
         tryReserve(cont);
-        copyTo(std::inserter(cont, cont.begin()));
+        insertInto(cont);
         return cont;
     }
 
@@ -506,7 +563,7 @@ public:
      */
     template<class OutputIterator>
     void copyTo(OutputIterator outputIterator) const {
-        std::copy(_begin, _end, outputIterator);
+        detail::copy(_begin, _end, std::move(outputIterator));
     }
 
     /**
@@ -572,6 +629,39 @@ public:
     }
 #endif // LZ_HAS_EXECUTION
 
+    /**
+     * @brief Returns the `index`th of `parts` sub views. The sub views 0, 1, ..., `parts - 1` contain all elements of this view,
+     * in order, without overlap, and can be iterated independently, e.g. by separate threads. Random access views are split in
+     * parts of equal size. Adapters over a sequence that can be split (e.g. a filter or map over a vector, or a concatenation
+     * of those) split that sequence instead, so their parts contain about as many underlying elements each.
+     * @example `for (int i : view.partition(1, 4)) // iterates the second quarter of view`
+     * @param index The index of the sub view. Must be smaller than `parts`.
+     * @param parts The amount of sub views.
+     * @return The sub view, which has the same iterator type as this view.
+     */
+    LZ_NODISCARD BasicIteratorView<It> partition(const std::size_t index, const std::size_t parts) const {
+        static_assert(detail::Partitioner<It>::value,
+                      "This view cannot be split. Only random access views and adapters over views that can be split, can be "
+                      "split");
+        LZ_ASSERT(index < parts, "index must be smaller than the amount of parts");
+        auto subRange = detail::Partitioner<It>::slice(_begin, _end, index, parts);
+        return { std::move(subRange.first), std::move(subRange.second) };
+    }
+
+    /**
+     * @brief Splits this view in `parts` sub views, see `partition`.
+     * @param parts The amount of sub views. Must be greater than 0.
+     * @return The sub views, in order.
+     */
+    LZ_NODISCARD std::vector<BasicIteratorView<It>> split(const std::size_t parts) const {
+        std::vector<BasicIteratorView<It>> subViews;
+        subViews.reserve(parts);
+        for (std::size_t index = 0; index < parts; ++index) {
+            subViews.push_back(partition(index, parts));
+        }
+        return subViews;
+    }
+
     /**
      * Creates a `std::map<<keyGen return type, value_type[, Compare[, Allocator]]>`. The keyGen function generates the keys
      * for the `std::map`. The value type is the current type this view contains. (`typename decltype(view)::value_type`).
@@ -610,7 +700,7 @@ public:
     toUnorderedMap(const KeySelectorFunc keyGen, const Allocator& alloc = {}, const KeyEquality& cmp = {},
                    const Hasher& h = {}) const {
         using UnorderedMap = std::unordered_map<KeyType<KeySelectorFunc>, value_type, Hasher, KeyEquality, Allocator>;
-        UnorderedMap um(static_cast<std::size_t>(detail::sizeHint(_begin, _end)), h, cmp, alloc);
+        UnorderedMap um(detail::reserveSize(detail::getSizeHint(_begin, _end)), h, cmp, alloc);
         createMap(um, keyGen);
         return um;
     }
@@ -677,7 +767,7 @@ public:
      * @return The length of the view.
      */
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 detail::DiffType<It> distance() const {
-        return std::distance(_begin, _end);
+        return detail::distance(_begin, _end);
     }
 
     /**
@@ -749,7 +839,7 @@ equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}, Ex
         return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
     else {
-        return std::equal(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
+        return detail::executeEqual(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
 }
 #endif // LZ_HAS_EXECUTION
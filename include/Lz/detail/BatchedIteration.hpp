@@ -0,0 +1,540 @@
+#pragma once
+
+#ifndef LZ_BATCHED_ITERATION_HPP
+#define LZ_BATCHED_ITERATION_HPP
+
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+namespace lz {
+namespace detail {
+/**
+ * Iterators for which every step is expensive, such as the type erased iterators of `AnyView`, can hand out many elements at
+ * once. Such an iterator defines `BatchSlot` as a type other than void, and has a member function
+ * `std::size_t pull(const Iterator& end, BatchSlot* out, std::size_t n)` that copies at most `n` elements into `out`, advances
+ * past them and returns how many elements were copied. Fewer than `n` elements are only copied if `end` is reached.
+ */
+template<class Iterator, class = void>
+struct HasBatchedPull : std::false_type {};
+
+template<class Iterator>
+struct HasBatchedPull<Iterator, EnableIf<!std::is_void<typename Iterator::BatchSlot>::value>> : std::true_type {};
+
+// The elements handed to a function are copies, so functions that modify the elements through a non const reference must not
+// get them batched
+template<class Iterator>
+struct CanForEachBatched
+    : std::integral_constant<bool, HasBatchedPull<Iterator>::value &&
+                                       !(std::is_lvalue_reference<RefType<Iterator>>::value &&
+                                         !std::is_const<typename std::remove_reference<RefType<Iterator>>::type>::value)> {};
+
+constexpr std::size_t BatchSize = 64;
+
+// Returns the copied element as the reference type of the iterator it was pulled from
+template<class Reference, class Slot>
+EnableIf<std::is_lvalue_reference<Reference>::value && !std::is_const<typename std::remove_reference<Reference>::type>::value,
+         Slot&>
+fromBatchSlot(Slot& slot) noexcept {
+    return slot;
+}
+
+template<class Reference, class Slot>
+EnableIf<!std::is_lvalue_reference<Reference>::value || std::is_const<typename std::remove_reference<Reference>::type>::value,
+         Reference>
+fromBatchSlot(Slot& slot) {
+    return static_cast<Reference>(std::move(slot));
+}
+
+// Calls `function(batch, count)` for every batch of [begin, end)
+template<class Iterator, class BatchFunction>
+void forEachBatch(Iterator begin, const Iterator& end, BatchFunction function) {
+    typename Iterator::BatchSlot batch[BatchSize];
+    std::size_t count;
+    do {
+        count = begin.pull(end, batch, BatchSize);
+        function(batch, count);
+    } while (count == BatchSize);
+}
+
+/**
+ * Iterators that may turn out to refer to contiguous memory at run time only, such as the type erased iterators of `AnyView`, or
+ * that refer to contiguous memory without being contiguous iterators, such as those of `CString` and of `TakeN` over a vector,
+ * define `ContiguousElement` as a type other than void, and have a member function
+ * `ContiguousElement* contiguousData(const Iterator& end, std::size_t& size) const` that returns the first element of
+ * [*this, end) and sets `size` if the range is contiguous and not empty, and null otherwise.
+ */
+template<class Iterator, class = void>
+struct HasContiguousData : std::false_type {};
+
+template<class Iterator>
+struct HasContiguousData<Iterator, EnableIf<!std::is_void<typename Iterator::ContiguousElement>::value>> : std::true_type {};
+
+#ifdef LZ_HAS_CONCEPTS
+template<class Iterator>
+struct IsContiguousIterator : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {};
+#else
+// Without concepts only pointers and the iterators of std::vector are known to be contiguous
+template<class Iterator, class Value = ValueType<Iterator>>
+struct IsContiguousIterator
+    : std::integral_constant<bool, std::is_pointer<Iterator>::value ||
+                                       (!std::is_same<Value, bool>::value &&
+                                        (std::is_same<Iterator, typename std::vector<Value>::iterator>::value ||
+                                         std::is_same<Iterator, typename std::vector<Value>::const_iterator>::value))> {};
+#endif // LZ_HAS_CONCEPTS
+
+/**
+ * Iterators over a sequence of sequences, such as those of `Concatenate` and `Flatten`, define `SegmentedIteration` as
+ * `std::true_type`, and have a member function `template<class SegmentFunc> bool segments(const Iterator& end, SegmentFunc& func)
+ * const` that calls `func(first, last)` for every non empty sub range of [*this, end) in order, until `func` returns false. The
+ * sub ranges consist of the iterators of the underlying sequences, so that the terminal operations can use the fast paths of
+ * those per sub range, e.g. one `memmove` per vector when a concatenation of vectors is copied. It returns false if `func`
+ * stopped the iteration, and true otherwise.
+ */
+template<class Iterator, class = void>
+struct HasSegments : std::false_type {};
+
+template<class Iterator>
+struct HasSegments<Iterator, EnableIf<Iterator::SegmentedIteration::value>> : std::true_type {};
+
+// Defined at the end of this file, so that they can use all dispatchers for their sub ranges
+template<class UnaryFunc>
+struct ForEachSegment;
+
+template<class OutputIterator>
+struct CopySegment;
+
+template<class T, class BinOp>
+struct AccumulateSegment;
+
+template<class Container>
+struct AppendSegment;
+
+/**
+ * Iterators that can loop over their elements with fewer checks than `operator++` and `operator!=` need, such as those of
+ * `Filter` (one loop over the underlying sequence that only stops at matches), define `PushIteration` as `std::true_type`, and
+ * have a member function `template<class Sink> bool push(const Iterator& end, Sink& sink) const` that calls `sink(element)` for
+ * every element of [*this, end) in order, until `sink` returns false. It returns false if `sink` stopped the iteration, and true
+ * otherwise. Iterators with `HasSegments` push one sub range after another.
+ */
+template<class Iterator, class = void>
+struct HasPushMember : std::false_type {};
+
+template<class Iterator>
+struct HasPushMember<Iterator, EnableIf<Iterator::PushIteration::value>> : std::true_type {};
+
+template<class Iterator>
+struct HasPush : std::integral_constant<bool, HasPushMember<Iterator>::value || HasSegments<Iterator>::value> {};
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_14 bool pushLoop(Iterator begin, const Iterator& end, Sink& sink) {
+    for (; begin != end; ++begin) {
+        if (!sink(*begin)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls `sink(element)` for every element of [begin, end), until `sink` returns false
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_14 EnableIf<!HasPush<Iterator>::value, bool> pushEach(Iterator begin, const Iterator& end, Sink& sink) {
+    return pushLoop(std::move(begin), end, sink);
+}
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasPushMember<Iterator>::value, bool>
+pushEach(const Iterator& begin, const Iterator& end, Sink& sink) {
+    return begin.push(end, sink);
+}
+
+template<class Sink>
+struct PushSegment;
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasSegments<Iterator>::value && !HasPushMember<Iterator>::value, bool>
+pushEach(const Iterator& begin, const Iterator& end, Sink& sink) {
+    PushSegment<Sink> segmentFunc{ sink };
+    return begin.segments(end, segmentFunc);
+}
+
+template<class Sink>
+struct PushSegment {
+    Sink& sink;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Iterator& first, const Iterator& last) const {
+        return detail::pushEach(first, last, sink);
+    }
+};
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 EnableIf<!CanForEachBatched<Iterator>::value && !HasPush<Iterator>::value>
+forEachBatched(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    std::for_each(std::move(begin), end, std::ref(func));
+}
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 EnableIf<!CanForEachBatched<Iterator>::value && HasPush<Iterator>::value>
+forEachBatched(const Iterator& begin, const Iterator& end, UnaryFunc& func) {
+    auto sink = [&func](RefType<Iterator> value) -> bool {
+        func(std::forward<RefType<Iterator>>(value));
+        return true;
+    };
+    pushEach(begin, end, sink);
+}
+
+template<class Iterator, class UnaryFunc>
+EnableIf<CanForEachBatched<Iterator>::value> forEachBatched(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    using Slot = typename Iterator::BatchSlot;
+    forEachBatch(std::move(begin), end, [&func](Slot* batch, const std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            func(fromBatchSlot<RefType<Iterator>>(batch[i]));
+        }
+    });
+}
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasSegments<Iterator>::value>
+forEachSegmented(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    forEachBatched(std::move(begin), end, func);
+}
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasSegments<Iterator>::value>
+forEachSegmented(const Iterator& begin, const Iterator& end, UnaryFunc& func) {
+    ForEachSegment<UnaryFunc> segmentFunc{ func };
+    begin.segments(end, segmentFunc);
+}
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<Iterator>::value> forEach(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    forEachSegmented(std::move(begin), end, func);
+}
+
+template<class Iterator, class UnaryFunc>
+EnableIf<HasContiguousData<Iterator>::value> forEach(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    std::size_t size = 0;
+    if (auto* data = begin.contiguousData(end, size)) {
+        std::for_each(data, data + size, std::ref(func));
+        return;
+    }
+    forEachBatched(std::move(begin), end, func);
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasBatchedPull<Iterator>::value && !HasPush<Iterator>::value, OutputIterator>
+copyBatched(Iterator begin, const Iterator& end, OutputIterator output) {
+    return std::copy(std::move(begin), end, std::move(output));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasBatchedPull<Iterator>::value && HasPush<Iterator>::value, OutputIterator>
+copyBatched(const Iterator& begin, const Iterator& end, OutputIterator output) {
+    auto sink = [&output](RefType<Iterator> value) -> bool {
+        *output = std::forward<RefType<Iterator>>(value);
+        ++output;
+        return true;
+    };
+    pushEach(begin, end, sink);
+    return output;
+}
+
+template<class Iterator, class OutputIterator>
+EnableIf<HasBatchedPull<Iterator>::value, OutputIterator>
+copyBatched(Iterator begin, const Iterator& end, OutputIterator output) {
+    using Slot = typename Iterator::BatchSlot;
+    forEachBatch(std::move(begin), end, [&output](Slot* batch, const std::size_t count) {
+        output = std::move(batch, batch + count, std::move(output));
+    });
+    return output;
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasSegments<Iterator>::value, OutputIterator>
+copySegmented(Iterator begin, const Iterator& end, OutputIterator output) {
+    return copyBatched(std::move(begin), end, std::move(output));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasSegments<Iterator>::value, OutputIterator>
+copySegmented(const Iterator& begin, const Iterator& end, OutputIterator output) {
+    CopySegment<OutputIterator> segmentFunc{ output };
+    begin.segments(end, segmentFunc);
+    return output;
+}
+
+// std::copy turns into a memmove if the output is a pointer (like) as well, and the elements are trivially copyable
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<Iterator>::value, OutputIterator>
+copy(Iterator begin, const Iterator& end, OutputIterator output) {
+    return copySegmented(std::move(begin), end, std::move(output));
+}
+
+template<class Iterator, class OutputIterator>
+EnableIf<HasContiguousData<Iterator>::value, OutputIterator> copy(Iterator begin, const Iterator& end, OutputIterator output) {
+    std::size_t size = 0;
+    if (const auto* data = begin.contiguousData(end, size)) {
+        return std::copy(data, data + size, std::move(output));
+    }
+    return copyBatched(std::move(begin), end, std::move(output));
+}
+
+// Random access ranges are inserted at once, so that e.g. `std::vector` allocates once and copies trivially copyable elements
+// with a memmove
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<Iterator>::value> appendRange(Container& container, Iterator begin, Iterator end) {
+    container.insert(container.end(), std::move(begin), std::move(end));
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!IsRandomAccess<Iterator>::value>
+appendRange(Container& container, Iterator begin, const Iterator& end) {
+    detail::copy(std::move(begin), end, std::back_inserter(container));
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasSegments<Iterator>::value>
+appendSegmented(Container& container, Iterator begin, const Iterator& end) {
+    appendRange(container, std::move(begin), end);
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasSegments<Iterator>::value>
+appendSegmented(Container& container, const Iterator& begin, const Iterator& end) {
+    AppendSegment<Container> segmentFunc{ container };
+    begin.segments(end, segmentFunc);
+}
+
+// Appends [begin, end) to `container`, which must have `insert(end(), first, last)` and `push_back`
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<Iterator>::value>
+appendTo(Container& container, Iterator begin, const Iterator& end) {
+    appendSegmented(container, std::move(begin), end);
+}
+
+template<class Container, class Iterator>
+EnableIf<HasContiguousData<Iterator>::value> appendTo(Container& container, Iterator begin, const Iterator& end) {
+    std::size_t size = 0;
+    if (const auto* data = begin.contiguousData(end, size)) {
+        container.insert(container.end(), data, data + size);
+        return;
+    }
+    appendSegmented(container, std::move(begin), end);
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasBatchedPull<Iterator>::value || IsRandomAccess<Iterator>::value, DiffType<Iterator>>
+distance(Iterator begin, const Iterator& end) {
+    return std::distance(std::move(begin), end);
+}
+
+template<class Iterator>
+EnableIf<HasBatchedPull<Iterator>::value && !IsRandomAccess<Iterator>::value, DiffType<Iterator>>
+distance(Iterator begin, const Iterator& end) {
+    DiffType<Iterator> count = 0;
+    forEachBatch(std::move(begin), end, [&count](typename Iterator::BatchSlot*, const std::size_t n) {
+        count += static_cast<DiffType<Iterator>>(n);
+    });
+    return count;
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 T accumulateRange(Iterator begin, const Iterator& end, T init, BinOp& binOp) {
+    while (begin != end) {
+        init = binOp(std::move(init), *begin);
+        ++begin;
+    }
+    return init;
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasBatchedPull<Iterator>::value && !HasPush<Iterator>::value, T>
+accumulateBatched(Iterator begin, const Iterator& end, T init, BinOp& binOp) {
+    return accumulateRange(std::move(begin), end, std::move(init), binOp);
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasBatchedPull<Iterator>::value && HasPush<Iterator>::value, T>
+accumulateBatched(const Iterator& begin, const Iterator& end, T init, BinOp& binOp) {
+    auto sink = [&init, &binOp](RefType<Iterator> value) -> bool {
+        init = binOp(std::move(init), std::forward<RefType<Iterator>>(value));
+        return true;
+    };
+    pushEach(begin, end, sink);
+    return init;
+}
+
+template<class Iterator, class T, class BinOp>
+EnableIf<HasBatchedPull<Iterator>::value, T> accumulateBatched(Iterator begin, const Iterator& end, T init, BinOp& binOp) {
+    using Slot = typename Iterator::BatchSlot;
+    forEachBatch(std::move(begin), end, [&init, &binOp](Slot* batch, const std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            init = binOp(std::move(init), fromBatchSlot<RefType<Iterator>>(batch[i]));
+        }
+    });
+    return init;
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasSegments<Iterator>::value, T>
+accumulateSegmented(Iterator begin, const Iterator& end, T init, BinOp& binOp) {
+    return accumulateBatched(std::move(begin), end, std::move(init), binOp);
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasSegments<Iterator>::value, T>
+accumulateSegmented(const Iterator& begin, const Iterator& end, T init, BinOp& binOp) {
+    AccumulateSegment<T, BinOp> segmentFunc{ init, binOp };
+    begin.segments(end, segmentFunc);
+    return init;
+}
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<Iterator>::value, T>
+accumulate(Iterator begin, const Iterator& end, T init, BinOp binOp) {
+    return accumulateSegmented(std::move(begin), end, std::move(init), binOp);
+}
+
+template<class Iterator, class T, class BinOp>
+EnableIf<HasContiguousData<Iterator>::value, T> accumulate(Iterator begin, const Iterator& end, T init, BinOp binOp) {
+    std::size_t size = 0;
+    if (auto* data = begin.contiguousData(end, size)) {
+        return accumulateRange(data, data + size, std::move(init), binOp);
+    }
+    return accumulateBatched(std::move(begin), end, std::move(init), binOp);
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasPush<Iterator>::value, bool>
+anyOf(Iterator begin, const Iterator& end, UnaryPredicate predicate) {
+    return std::any_of(std::move(begin), end, std::move(predicate));
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasPush<Iterator>::value, bool>
+anyOf(const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    // The sink stops the iteration at the first match
+    auto sink = [&predicate](RefType<Iterator> value) -> bool {
+        return !predicate(std::forward<RefType<Iterator>>(value));
+    };
+    return !pushEach(begin, end, sink);
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool allOf(Iterator begin, const Iterator& end, UnaryPredicate predicate) {
+    return !anyOf(std::move(begin), end, [&predicate](RefType<Iterator> value) -> bool {
+        return !predicate(std::forward<RefType<Iterator>>(value));
+    });
+}
+
+template<class Element, class T>
+struct IsMemchrSearchable
+    : std::integral_constant<bool, std::is_integral<Element>::value && !std::is_same<Element, bool>::value &&
+                                       sizeof(Element) == 1 && std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+
+template<class Element, class T>
+EnableIf<!IsMemchrSearchable<Decay<Element>, T>::value, bool>
+containsContiguous(Element* data, const std::size_t size, const T& value) {
+    return std::find(data, data + size, value) != data + size;
+}
+
+template<class Element, class T>
+EnableIf<IsMemchrSearchable<Decay<Element>, T>::value, bool>
+containsContiguous(Element* data, const std::size_t size, const T& value) {
+    using Byte = Decay<Element>;
+    // A value that does not fit in a byte compares unequal to every element
+    if (static_cast<T>(static_cast<Byte>(value)) != value) {
+        return false;
+    }
+    return std::memchr(data, static_cast<unsigned char>(static_cast<Byte>(value)), size) != nullptr;
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<Iterator>::value, bool>
+contains(Iterator begin, const Iterator& end, const T& value) {
+    return std::find(std::move(begin), end, value) != end;
+}
+
+template<class Iterator, class T>
+EnableIf<HasContiguousData<Iterator>::value, bool> contains(Iterator begin, const Iterator& end, const T& value) {
+    std::size_t size = 0;
+    if (auto* data = begin.contiguousData(end, size)) {
+        return containsContiguous(data, size, value);
+    }
+    return std::find(std::move(begin), end, value) != end;
+}
+
+// Returns whether [beginB, endB) is found in [beginA, endA)
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasContiguousData<IteratorA>::value, bool>
+search(IteratorA beginA, const IteratorA& endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare) {
+    return std::search(std::move(beginA), endA, std::move(beginB), std::move(endB), std::move(compare)) != endA;
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+EnableIf<HasContiguousData<IteratorA>::value, bool>
+search(IteratorA beginA, const IteratorA& endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare) {
+    std::size_t size = 0;
+    if (auto* data = beginA.contiguousData(endA, size)) {
+        return std::search(data, data + size, std::move(beginB), std::move(endB), std::move(compare)) != data + size;
+    }
+    return std::search(std::move(beginA), endA, std::move(beginB), std::move(endB), std::move(compare)) != endA;
+}
+
+template<class UnaryFunc>
+struct ForEachSegment {
+    UnaryFunc& func;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Iterator& first, const Iterator& last) const {
+        detail::forEach(first, last, func);
+        return true;
+    }
+};
+
+template<class OutputIterator>
+struct CopySegment {
+    OutputIterator& output;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Iterator& first, const Iterator& last) const {
+        output = detail::copy(first, last, std::move(output));
+        return true;
+    }
+};
+
+template<class T, class BinOp>
+struct AccumulateSegment {
+    T& init;
+    BinOp& binOp;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Iterator& first, const Iterator& last) const {
+        init = detail::accumulate(first, last, std::move(init), std::ref(binOp));
+        return true;
+    }
+};
+
+template<class Container>
+struct AppendSegment {
+    Container& container;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Iterator& first, const Iterator& last) const {
+        detail::appendTo(container, first, last);
+        return true;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_BATCHED_ITERATION_HPP
@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef LZ_BLOOM_FILTER_HPP
+#define LZ_BLOOM_FILTER_HPP
+
+#include "Lz/detail/Procs.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * A blocked bloom filter: every key sets all of its bits in one 64 byte block (a cache line), so a lookup touches a single cache
+ * line. The amount of blocks and bits per key are derived from the expected amount of keys and the requested false positive rate.
+ */
+class BlockedBloomFilter {
+    static constexpr std::size_t WordsPerBlock = 8;
+    static constexpr std::size_t BitsPerBlock = WordsPerBlock * 64;
+
+    std::vector<std::uint64_t> _words{};
+    std::size_t _blockCount{};
+    unsigned _hashCount{};
+
+    struct Probe {
+        std::size_t firstWord;
+        std::uint32_t position;
+        std::uint32_t step;
+    };
+
+    Probe probe(std::uint64_t hash) const {
+        // std::hash is the identity for integers on most implementations, which is not usable for a bloom filter
+        hash = mixHash(hash);
+        // The high half selects the block. The low half is used for double hashing within the block: bits 0-15 are the first
+        // position, bits 16-31 the step, which is odd so that all bit positions can be reached. This way, keys in the same block
+        // do not have correlated steps
+        return { static_cast<std::size_t>(hash >> 32) % _blockCount * WordsPerBlock, static_cast<std::uint32_t>(hash & 0xFFFF),
+                 static_cast<std::uint32_t>((hash >> 16) & 0xFFFF) | 1U };
+    }
+
+public:
+    BlockedBloomFilter() = default;
+
+    BlockedBloomFilter(const std::size_t expectedKeys, const double falsePositiveRate) {
+        // Optimal amount of bits per key is -ln(p) / ln(2)^2 and the optimal amount of hashes is bitsPerKey * ln(2)
+        const double ln2 = std::log(2.0);
+        const double rate = falsePositiveRate <= 0 ? 1e-9 : falsePositiveRate >= 1 ? 0.5 : falsePositiveRate;
+        const double bitsPerKey = -std::log(rate) / (ln2 * ln2);
+        const auto totalBits = static_cast<std::size_t>(std::ceil(bitsPerKey * static_cast<double>(expectedKeys)));
+        const auto hashCount = static_cast<unsigned>(std::lround(bitsPerKey * ln2));
+
+        _blockCount = totalBits / BitsPerBlock + 1;
+        _hashCount = hashCount < 1 ? 1 : hashCount > 16 ? 16 : hashCount;
+        _words.assign(_blockCount * WordsPerBlock, 0);
+    }
+
+    void insert(const std::uint64_t hash) {
+        Probe p = probe(hash);
+        for (unsigned i = 0; i < _hashCount; ++i, p.position += p.step) {
+            const std::size_t bit = p.position % BitsPerBlock;
+            _words[p.firstWord + bit / 64] |= std::uint64_t{ 1 } << (bit % 64);
+        }
+    }
+
+    LZ_NODISCARD bool mayContain(const std::uint64_t hash) const {
+        Probe p = probe(hash);
+        for (unsigned i = 0; i < _hashCount; ++i, p.position += p.step) {
+            const std::size_t bit = p.position % BitsPerBlock;
+            if ((_words[p.firstWord + bit / 64] & (std::uint64_t{ 1 } << (bit % 64))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    LZ_NODISCARD std::size_t sizeInBytes() const noexcept {
+        return _words.size() * sizeof(std::uint64_t);
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_BLOOM_FILTER_HPP
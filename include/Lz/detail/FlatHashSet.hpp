@@ -0,0 +1,148 @@
+#pragma once
+
+#ifndef LZ_FLAT_HASH_SET_HPP
+#define LZ_FLAT_HASH_SET_HPP
+
+#include "Lz/detail/Procs.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * An insert only hash set with open addressing and linear probing. The keys are stored contiguously in insertion order, the
+ * table only holds their hashes and indices, so every key can be referred to by its index. As long as the set holds at most
+ * `SmallSize` keys no table is built at all and the keys are compared one by one, which is faster than hashing for tiny sets.
+ */
+template<class Key, class Hash, class KeyEqual>
+class FlatHashSet {
+    static constexpr std::size_t SmallSize = 8;
+    static constexpr std::size_t MinCapacity = 32;
+
+    struct Slot {
+        std::size_t hash;
+        std::size_t index;
+    };
+
+    std::vector<Key> _keys{};
+    std::vector<Slot> _slots{};
+    Hash _hash{};
+    KeyEqual _keyEqual{};
+
+    template<class K>
+    std::size_t hashOf(const K& key) const {
+        return static_cast<std::size_t>(mixHash(static_cast<std::uint64_t>(_hash(key))));
+    }
+
+    void placeInTable(const Slot slot) {
+        const std::size_t mask = _slots.size() - 1;
+        std::size_t pos = slot.hash & mask;
+        while (_slots[pos].index != npos()) {
+            pos = (pos + 1) & mask;
+        }
+        _slots[pos] = slot;
+    }
+
+    void rehash(const std::size_t capacity) {
+        std::vector<Slot> old(capacity, Slot{ 0, npos() });
+        old.swap(_slots);
+        if (old.empty()) {
+            for (std::size_t i = 0; i < _keys.size(); ++i) {
+                placeInTable({ hashOf(_keys[i]), i });
+            }
+            return;
+        }
+        for (const Slot slot : old) {
+            if (slot.index != npos()) {
+                placeInTable(slot);
+            }
+        }
+    }
+
+    // Compares all keys without an early exit, the loop is short enough, and a mispredicted exit costs more than the comparisons
+    template<class K>
+    std::size_t findSmall(const K& key) const {
+        std::size_t found = npos();
+        for (std::size_t i = 0; i < _keys.size(); ++i) {
+            found = _keyEqual(_keys[i], key) ? i : found;
+        }
+        return found;
+    }
+
+public:
+    static constexpr std::size_t npos() noexcept {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    FlatHashSet() = default;
+
+    FlatHashSet(Hash hash, KeyEqual keyEqual) : _hash(std::move(hash)), _keyEqual(std::move(keyEqual)) {
+    }
+
+    // Returns the index of `key` and true if it was inserted, or the index of the equal key and false if it was already present
+    template<class K>
+    std::pair<std::size_t, bool> insert(K&& key) {
+        if (_slots.empty()) {
+            const std::size_t index = findSmall(key);
+            if (index != npos()) {
+                return { index, false };
+            }
+            _keys.push_back(std::forward<K>(key));
+            if (_keys.size() > SmallSize) {
+                rehash(MinCapacity);
+            }
+            return { _keys.size() - 1, true };
+        }
+
+        const std::size_t hash = hashOf(key);
+        const std::size_t mask = _slots.size() - 1;
+        std::size_t pos = hash & mask;
+        for (; _slots[pos].index != npos(); pos = (pos + 1) & mask) {
+            const Slot slot = _slots[pos];
+            if (slot.hash == hash && _keyEqual(_keys[slot.index], key)) {
+                return { slot.index, false };
+            }
+        }
+
+        const std::size_t index = _keys.size();
+        _keys.push_back(std::forward<K>(key));
+        _slots[pos] = { hash, index };
+        // Keep the load factor below 3/4, beyond that linear probing degrades quickly
+        if (_keys.size() * 4 >= _slots.size() * 3) {
+            rehash(_slots.size() * 2);
+        }
+        return { index, true };
+    }
+
+    // Returns the index of `key`, or `npos()` if it is not in the set
+    template<class K>
+    LZ_NODISCARD std::size_t find(const K& key) const {
+        if (_slots.empty()) {
+            return findSmall(key);
+        }
+        const std::size_t hash = hashOf(key);
+        const std::size_t mask = _slots.size() - 1;
+        for (std::size_t pos = hash & mask; _slots[pos].index != npos(); pos = (pos + 1) & mask) {
+            const Slot slot = _slots[pos];
+            if (slot.hash == hash && _keyEqual(_keys[slot.index], key)) {
+                return slot.index;
+            }
+        }
+        return npos();
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _keys.size();
+    }
+
+    LZ_NODISCARD const Key& operator[](const std::size_t index) const noexcept {
+        return _keys[index];
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_FLAT_HASH_SET_HPP
@@ -5,6 +5,7 @@
 
 #include "Lz/detail/Traits.hpp"
 
+#include <memory>
 #include <type_traits>
 
 namespace lz {
@@ -82,10 +83,11 @@ class FunctionContainer {
 #endif
 
 public:
-    constexpr explicit FunctionContainer(const Func& func) : _func(func), _isConstructed(true) {
+    // Implicit, so that a function can be passed where a `FunctionStorage` is expected
+    constexpr FunctionContainer(const Func& func) : _func(func), _isConstructed(true) {
     }
 
-    constexpr explicit FunctionContainer(Func&& func) noexcept : _func(std::move(func)), _isConstructed(true) {
+    constexpr FunctionContainer(Func&& func) noexcept : _func(std::move(func)), _isConstructed(true) {
     }
 
     constexpr FunctionContainer() : FunctionContainer(std::is_default_constructible<Func>()) {
@@ -126,6 +128,10 @@ public:
         return *this;
     }
 
+    LZ_NODISCARD constexpr const Func& function() const noexcept {
+        return _func;
+    }
+
     template<class... Args>
     LZ_CONSTEXPR_CXX_14 auto operator()(Args&&... args) const -> decltype(_func(std::forward<Args>(args)...)) {
         return _func(std::forward<Args>(args)...);
@@ -137,6 +143,64 @@ public:
     }
 };
 
+/**
+ * Holds one copy of a function that is shared by all iterators of a view, instead of one copy per iterator. Copying an iterator
+ * then only copies a pointer, no matter how large the captured state of the function is. The function is moved to the heap when
+ * it is converted to a `SharedFunctionContainer`, which views do once in their constructor, before creating their iterators.
+ */
+template<class Func>
+class SharedFunctionContainer {
+    std::shared_ptr<const Func> _func{};
+
+public:
+    // Implicit, so that a function can be passed where a `FunctionStorage` is expected
+    SharedFunctionContainer(Func func) : _func(std::make_shared<const Func>(std::move(func))) {
+    }
+
+    SharedFunctionContainer() = default;
+
+    LZ_NODISCARD const Func& function() const noexcept {
+        return *_func;
+    }
+
+    template<class... Args>
+    auto operator()(Args&&... args) const -> decltype((*_func)(std::forward<Args>(args)...)) {
+        return (*_func)(std::forward<Args>(args)...);
+    }
+};
+
+template<class MemberFunction>
+struct IsConstCallOperator : std::false_type {};
+
+template<class R, class C, class... Args>
+struct IsConstCallOperator<R (C::*)(Args...) const> : std::true_type {};
+
+#ifdef __cpp_noexcept_function_type
+template<class R, class C, class... Args>
+struct IsConstCallOperator<R (C::*)(Args...) const noexcept> : std::true_type {};
+#endif // __cpp_noexcept_function_type
+
+// Only functions with a single, const call operator can be shared: calling them does not change their state
+template<class Func, class = void>
+struct HasConstCallOperator : std::false_type {};
+
+template<class Func>
+struct HasConstCallOperator<Func, void_t<decltype(&Func::operator())>> : IsConstCallOperator<decltype(&Func::operator())> {};
+
+template<class Func>
+struct IsSharedFunction
+    : std::integral_constant<bool, HasConstCallOperator<Func>::value &&
+                                       (sizeof(Func) > 2 * sizeof(void*) || !std::is_trivially_copyable<Func>::value)> {};
+
+/**
+ * The function storage of the iterators of adapters that take a predicate or selector. Small, trivially copyable functions, such
+ * as captureless lambdas, are stored inline. Larger ones, like `std::function` or lambdas that capture a container, are stored
+ * once per view so that deep pipelines keep their iterators a few words large. The constructors of views and of their iterators
+ * take a `FunctionStorage` rather than the function itself, so that the iterators of a view share the storage the view created.
+ */
+template<class Func>
+using FunctionStorage = Conditional<IsSharedFunction<Func>::value, SharedFunctionContainer<Func>, FunctionContainer<Func>>;
+
 template<class Func, class... Iterators>
 using IteratorFnRetT = FunctionReturnType<FunctionContainer<Func>, decltype(*std::declval<Iterators>())...>;
 
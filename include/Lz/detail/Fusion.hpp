@@ -0,0 +1,95 @@
+#pragma once
+
+#ifndef LZ_FUSION_HPP
+#define LZ_FUSION_HPP
+
+#include "Lz/Predicates.hpp"
+#include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/iterators/FilterIterator.hpp"
+#include "Lz/detail/iterators/MapIterator.hpp"
+#include "Lz/detail/iterators/TakeNIterator.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace lz {
+namespace detail {
+/**
+ * Adjacent adapters in an `IterView` chain are fused into one adapter where possible, so that `.map(f).map(g)` becomes a single
+ * `MapIterator` calling `g(f(x))` and `.filter(p).filter(q)` a single `FilterIterator` testing `p(x) && q(x)`. This keeps the
+ * nesting depth of the iterator types, and with that the number of end checks per element, down.
+ */
+template<class First, class Second>
+class ComposedFn {
+    FunctionStorage<First> _first{};
+    FunctionStorage<Second> _second{};
+
+public:
+    constexpr ComposedFn() = default;
+
+    ComposedFn(First first, Second second) : _first(std::move(first)), _second(std::move(second)) {
+    }
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_14 auto operator()(T&& value) const -> decltype(_second(_first(std::forward<T>(value)))) {
+        return _second(_first(std::forward<T>(value)));
+    }
+};
+
+template<class First, class Second>
+class ConjunctionFn {
+    FunctionStorage<First> _first{};
+    FunctionStorage<Second> _second{};
+
+public:
+    constexpr ConjunctionFn() = default;
+
+    ConjunctionFn(First first, Second second) : _first(std::move(first)), _second(std::move(second)) {
+    }
+
+    // `value` is only forwarded to the second predicate, which is only called if the first one holds
+    template<class T>
+    LZ_CONSTEXPR_CXX_14 bool operator()(T&& value) const {
+        return _first(value) && _second(std::forward<T>(value));
+    }
+};
+
+template<class Iterator, class Function>
+struct MapFusion : std::false_type {};
+
+template<class Iterator, class First, class Second>
+struct MapFusion<MapIterator<Iterator, First>, Second> : std::true_type {
+    using Function = ComposedFn<First, Second>;
+    using iterator = MapIterator<Iterator, Function>;
+};
+
+template<class First, class Second>
+struct PredicateFusion {
+    // Predicates from lz::pred stay predicates from lz::pred when combined, so that they can still be vectorized
+    using type = Conditional<pred::IsPredicate<First>::value && pred::IsPredicate<Second>::value, pred::And<First, Second>,
+                             ConjunctionFn<First, Second>>;
+};
+
+template<class Iterator, class Predicate>
+struct FilterFusion : std::false_type {};
+
+#ifdef LZ_HAS_EXECUTION
+template<class Iterator, class First, class Execution, class Second>
+struct FilterFusion<FilterIterator<Iterator, First, Execution>, Second> : std::true_type {
+#else  // ^^^ LZ_HAS_EXECUTION vvv !LZ_HAS_EXECUTION
+template<class Iterator, class First, class Second>
+struct FilterFusion<FilterIterator<Iterator, First>, Second> : std::true_type {
+#endif // LZ_HAS_EXECUTION
+    using BaseIterator = Iterator;
+    using Predicate = typename PredicateFusion<First, Second>::type;
+};
+
+template<class Iterator>
+struct IsTakeNIterator : std::false_type {};
+
+template<class Iterator>
+struct IsTakeNIterator<TakeNIterator<Iterator>> : std::true_type {};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_FUSION_HPP
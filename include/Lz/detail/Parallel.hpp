@@ -0,0 +1,588 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_HPP
+#define LZ_PARALLEL_HPP
+
+#include "Lz/Execution.hpp"
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/Optional.hpp"
+#include "Lz/detail/Procs.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef LZ_HAS_EXECUTION
+#include <execution>
+#endif // LZ_HAS_EXECUTION
+
+namespace lz {
+namespace detail {
+/**
+ * Splits an iterator range [begin, end) into `parts` disjoint sub ranges, so that a terminal operation can run one sequential
+ * pass per sub range on a separate thread. The default partitioner only splits random access ranges. Adapters that only
+ * forward their underlying iterator (filter, except, map) specialize this struct so that their underlying range is split
+ * instead, after which every sub range is searched independently.
+ */
+template<class Iterator, class = void>
+struct Partitioner {
+    static constexpr bool value = IsRandomAccess<Iterator>::value;
+
+    static std::pair<Iterator, Iterator>
+    slice(const Iterator& begin, const Iterator& end, const std::size_t index, const std::size_t parts) {
+        using Diff = DiffType<Iterator>;
+        const auto size = static_cast<std::size_t>(end - begin);
+        return { begin + static_cast<Diff>(size * index / parts), begin + static_cast<Diff>(size * (index + 1) / parts) };
+    }
+};
+
+// Random access iterators are handled by the std algorithms themselves, only the other iterators need partitioning
+template<class Iterator>
+struct IsPartitionable : std::integral_constant<bool, !IsRandomAccess<Iterator>::value && Partitioner<Iterator>::value> {};
+
+inline std::size_t partitionCount() {
+    const auto threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    // Use more partitions than threads, so that partitions with more matches than others do not stall the rest
+    return threads == 0 ? 1 : threads * 4;
+}
+
+// A pool policy decides the amount of partitions itself, see `lz::execution::PoolPolicy::chunks`
+template<class Execution>
+EnableIf<IsPoolPolicy<Execution>::value, std::size_t> partitionCount(const Execution& execution) {
+    return execution.chunkCount();
+}
+
+// Calls `indexFunc(index)` for every index in [0, count), on the threads of `execution`
+template<class Execution, class IndexFunc>
+EnableIf<IsPoolPolicy<Execution>::value> forEachIndex(const Execution& execution, const std::size_t count, IndexFunc indexFunc) {
+    execution.threadPool().run(count, indexFunc);
+}
+
+#ifdef LZ_HAS_EXECUTION
+template<class Execution>
+EnableIf<!IsPoolPolicy<Execution>::value, std::size_t> partitionCount(const Execution&) {
+    return partitionCount();
+}
+
+template<class Execution, class IndexFunc>
+EnableIf<!IsPoolPolicy<Execution>::value> forEachIndex(Execution execution, const std::size_t count, IndexFunc indexFunc) {
+    std::vector<std::size_t> indices(count);
+    std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+    std::for_each(execution, indices.begin(), indices.end(), std::move(indexFunc));
+}
+
+// Whether `Execution` may run on multiple threads: a pool policy, or a standard policy other than `std::execution::seq`
+template<class Execution>
+struct IsParallelPolicy : std::integral_constant<bool, !IsSequencedPolicy<Execution>::value> {};
+#else
+template<class Execution>
+struct IsParallelPolicy : IsPoolPolicy<Execution> {};
+#endif // LZ_HAS_EXECUTION
+
+template<class Execution, class Iterator, class PartitionFunc>
+void forEachPartition(Execution execution, const Iterator& begin, const Iterator& end, const std::size_t parts,
+                      PartitionFunc partitionFunc) {
+    forEachIndex(execution, parts, [&begin, &end, &partitionFunc, parts](const std::size_t index) {
+        auto subRange = Partitioner<Iterator>::slice(begin, end, index, parts);
+        partitionFunc(std::move(subRange.first), std::move(subRange.second), index);
+    });
+}
+
+template<class Execution, class Iterator, class OutputIterator>
+OutputIterator partitionedCopy(Execution execution, const Iterator& begin, const Iterator& end, OutputIterator output) {
+    const auto parts = partitionCount(execution);
+    std::vector<std::vector<ValueType<Iterator>>> buffers(parts);
+    forEachPartition(execution, begin, end, parts, [&buffers](Iterator first, Iterator last, const std::size_t index) {
+        std::copy(std::move(first), std::move(last), std::back_inserter(buffers[index]));
+    });
+
+    for (auto& buffer : buffers) {
+        output = std::move(buffer.begin(), buffer.end(), std::move(output));
+    }
+    return output;
+}
+
+template<class Execution, class Iterator, class UnaryFunc>
+void partitionedForEach(Execution execution, const Iterator& begin, const Iterator& end, UnaryFunc func) {
+    forEachPartition(execution, begin, end, partitionCount(execution), [&func](Iterator first, Iterator last, std::size_t) {
+        std::for_each(std::move(first), std::move(last), func);
+    });
+}
+
+template<class Execution, class Iterator, class T, class BinaryFunction>
+T partitionedFoldl(Execution execution, const Iterator& begin, const Iterator& end, T init, BinaryFunction function) {
+    const auto parts = partitionCount(execution);
+    std::vector<Optional<Decay<T>>> partials(parts);
+    forEachPartition(execution, begin, end, parts,
+                     [&partials, &function](Iterator first, Iterator last, const std::size_t index) {
+                         if (first == last) {
+                             return;
+                         }
+                         Decay<T> partial(*first);
+                         for (++first; first != last; ++first) {
+                             partial = function(std::move(partial), *first);
+                         }
+                         partials[index] = std::move(partial);
+                     });
+
+    for (auto& partial : partials) {
+        if (partial) {
+            init = function(std::move(init), std::move(*partial));
+        }
+    }
+    return init;
+}
+
+// Folds every partition in order with `accumulate`, starting from a copy of `identity`, and then merges the partial results in
+// the order of the partitions with `combine`. Neither function needs to be commutative
+template<class Execution, class Iterator, class T, class Accumulate, class Combine>
+T partitionedReduce(Execution execution, const Iterator& begin, const Iterator& end, const T& identity, Accumulate accumulate,
+                    Combine combine) {
+    const auto parts = partitionCount(execution);
+    std::vector<T> partials(parts, identity);
+    forEachPartition(execution, begin, end, parts,
+                     [&partials, &accumulate](Iterator first, Iterator last, const std::size_t index) {
+                         T& partial = partials[index];
+                         for (; first != last; ++first) {
+                             partial = accumulate(std::move(partial), *first);
+                         }
+                     });
+
+    T result = std::move(partials.front());
+    for (std::size_t index = 1; index < parts; ++index) {
+        result = combine(std::move(result), std::move(partials[index]));
+    }
+    return result;
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool partitionedAnyOf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    std::atomic<bool> found{ false };
+    forEachPartition(execution, begin, end, partitionCount(execution),
+                     [&found, &predicate](Iterator first, Iterator last, std::size_t) {
+                         for (; first != last && !found.load(std::memory_order_relaxed); ++first) {
+                             if (predicate(*first)) {
+                                 found.store(true, std::memory_order_relaxed);
+                             }
+                         }
+                     });
+    return found.load();
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+DiffType<Iterator> partitionedCountIf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    std::atomic<DiffType<Iterator>> count{ 0 };
+    forEachPartition(execution, begin, end, partitionCount(execution),
+                     [&count, &predicate](Iterator first, Iterator last, std::size_t) {
+                         count.fetch_add(std::count_if(std::move(first), std::move(last), predicate), std::memory_order_relaxed);
+                     });
+    return count.load();
+}
+
+// Returns the first element for which `predicate` returns true. Partitions after the partition of the first match found so far
+// stop searching
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator partitionedFindIf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    const auto parts = partitionCount(execution);
+    std::vector<Optional<Iterator>> matches(parts);
+    std::atomic<std::size_t> firstMatch{ parts };
+    forEachPartition(execution, begin, end, parts,
+                     [&matches, &firstMatch, &predicate](Iterator first, Iterator last, const std::size_t index) {
+                         for (; first != last && index < firstMatch.load(std::memory_order_relaxed); ++first) {
+                             if (!predicate(*first)) {
+                                 continue;
+                             }
+                             matches[index] = std::move(first);
+                             std::size_t current = firstMatch.load();
+                             while (index < current && !firstMatch.compare_exchange_weak(current, index)) {
+                             }
+                             return;
+                         }
+                     });
+    const std::size_t index = firstMatch.load();
+    return index == parts ? end : std::move(*matches[index]);
+}
+
+// Selects the best element of every partition with `select`, and then the best of those, preferring earlier partitions on ties
+template<class Execution, class Iterator, class Select, class Compare>
+Iterator partitionedSelect(Execution execution, const Iterator& begin, const Iterator& end, Select select, Compare compare) {
+    const auto parts = partitionCount(execution);
+    std::vector<Optional<Iterator>> candidates(parts);
+    forEachPartition(execution, begin, end, parts,
+                     [&candidates, &select, &compare](Iterator first, Iterator last, const std::size_t index) {
+                         if (first != last) {
+                             candidates[index] = select(std::move(first), std::move(last), compare);
+                         }
+                     });
+
+    Optional<Iterator> best;
+    for (auto& candidate : candidates) {
+        if (candidate && (!best || select.isBetter(**candidate, **best, compare))) {
+            best = std::move(*candidate);
+        }
+    }
+    return best ? std::move(*best) : end;
+}
+
+struct SelectMin {
+    template<class Iterator, class Compare>
+    Iterator operator()(Iterator first, Iterator last, Compare& compare) const {
+        return std::min_element(std::move(first), std::move(last), compare);
+    }
+
+    template<class T, class Compare>
+    static bool isBetter(const T& candidate, const T& best, Compare& compare) {
+        return compare(candidate, best);
+    }
+};
+
+struct SelectMax {
+    template<class Iterator, class Compare>
+    Iterator operator()(Iterator first, Iterator last, Compare& compare) const {
+        return std::max_element(std::move(first), std::move(last), compare);
+    }
+
+    template<class T, class Compare>
+    static bool isBetter(const T& candidate, const T& best, Compare& compare) {
+        return compare(best, candidate);
+    }
+};
+
+// Used by `lz::parallelReduce`: parallel policies over sequences that can be split reduce every partition separately
+template<class Execution, class Iterator, class T, class Accumulate, class Combine>
+EnableIf<IsParallelPolicy<Execution>::value && Partitioner<Iterator>::value, T>
+reduceParts(const Execution& execution, const Iterator& begin, const Iterator& end, const T& identity, Accumulate accumulate,
+            Combine combine) {
+    return partitionedReduce(execution, begin, end, identity, std::move(accumulate), std::move(combine));
+}
+
+// Other sequences are folded on the calling thread, without `combine`
+template<class Execution, class Iterator, class T, class Accumulate, class Combine>
+EnableIf<!(IsParallelPolicy<Execution>::value && Partitioner<Iterator>::value), T>
+reduceParts(const Execution&, Iterator begin, const Iterator& end, T identity, Accumulate accumulate, Combine) {
+    for (; begin != end; ++begin) {
+        identity = accumulate(std::move(identity), *begin);
+    }
+    return identity;
+}
+
+#ifdef LZ_HAS_EXECUTION
+
+/*
+ * The functions below are called by the terminal operations for every execution policy that is not sequenced. For the standard
+ * policies they call the standard algorithm with the policy. For a pool policy, the sequence is split by its Partitioner and
+ * every partition is processed by a task of the pool, after which the partition results are combined in order. Sequences that
+ * cannot be split, and algorithms that do not split well (`nth_element`, `search`), run on the calling thread.
+ */
+
+template<class Execution, class Iterator, class UnaryFunc>
+void executeForEach(Execution execution, const Iterator& begin, const Iterator& end, UnaryFunc func) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        std::for_each(execution, begin, end, std::move(func));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        partitionedForEach(execution, begin, end, std::move(func));
+    }
+    else {
+        std::for_each(begin, end, std::move(func));
+    }
+}
+
+template<class Execution, class Iterator, class T, class BinaryFunction>
+T executeReduce(Execution execution, const Iterator& begin, const Iterator& end, T init, BinaryFunction function) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::reduce(execution, begin, end, std::move(init), std::move(function));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedFoldl(execution, begin, end, std::move(init), std::move(function));
+    }
+    else {
+        return std::reduce(begin, end, std::move(init), std::move(function));
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool executeAnyOf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::any_of(execution, begin, end, std::move(predicate));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedAnyOf(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return std::any_of(begin, end, std::move(predicate));
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool executeAllOf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::all_of(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return !executeAnyOf(execution, begin, end, [&predicate](RefType<Iterator> value) { return !predicate(value); });
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+bool executeNoneOf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::none_of(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return !executeAnyOf(execution, begin, end, std::move(predicate));
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+DiffType<Iterator> executeCountIf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::count_if(execution, begin, end, std::move(predicate));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedCountIf(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return std::count_if(begin, end, std::move(predicate));
+    }
+}
+
+template<class Execution, class Iterator, class T>
+DiffType<Iterator> executeCount(Execution execution, const Iterator& begin, const Iterator& end, const T& value) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::count(execution, begin, end, value);
+    }
+    else {
+        return executeCountIf(execution, begin, end, [&value](RefType<Iterator> element) { return element == value; });
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator executeFindIf(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::find_if(execution, begin, end, std::move(predicate));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedFindIf(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return std::find_if(begin, end, std::move(predicate));
+    }
+}
+
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator executeFindIfNot(Execution execution, const Iterator& begin, const Iterator& end, UnaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::find_if_not(execution, begin, end, std::move(predicate));
+    }
+    else {
+        return executeFindIf(execution, begin, end, [&predicate](RefType<Iterator> value) { return !predicate(value); });
+    }
+}
+
+template<class Execution, class Iterator, class T>
+Iterator executeFind(Execution execution, const Iterator& begin, const Iterator& end, const T& value) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::find(execution, begin, end, value);
+    }
+    else {
+        return executeFindIf(execution, begin, end, [&value](RefType<Iterator> element) { return element == value; });
+    }
+}
+
+template<class Execution, class Iterator, class Compare>
+Iterator executeMinElement(Execution execution, const Iterator& begin, const Iterator& end, Compare compare) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::min_element(execution, begin, end, std::move(compare));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedSelect(execution, begin, end, SelectMin{}, std::move(compare));
+    }
+    else {
+        return std::min_element(begin, end, std::move(compare));
+    }
+}
+
+template<class Execution, class Iterator, class Compare>
+Iterator executeMaxElement(Execution execution, const Iterator& begin, const Iterator& end, Compare compare) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::max_element(execution, begin, end, std::move(compare));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedSelect(execution, begin, end, SelectMax{}, std::move(compare));
+    }
+    else {
+        return std::max_element(begin, end, std::move(compare));
+    }
+}
+
+template<class Execution, class Iterator, class Compare>
+bool executeIsSorted(Execution execution, const Iterator& begin, const Iterator& end, Compare compare) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::is_sorted(execution, begin, end, std::move(compare));
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        // The end of a slice cannot be incremented into the next slice (a filter slice ends at the end of its source), so every
+        // partition keeps its first and last element, and the pairs that span two partitions are compared afterwards
+        const auto parts = partitionCount(execution);
+        std::vector<std::pair<Iterator, Iterator>> bounds(parts, { end, end });
+        std::atomic<bool> sorted{ true };
+        forEachPartition(execution, begin, end, parts,
+                         [&sorted, &compare, &bounds](Iterator first, Iterator last, const std::size_t index) {
+                             if (first == last || !sorted.load(std::memory_order_relaxed)) {
+                                 return;
+                             }
+                             Iterator previous = first;
+                             for (Iterator it = std::next(first); it != last; ++it) {
+                                 if (compare(*it, *previous)) {
+                                     sorted.store(false, std::memory_order_relaxed);
+                                     return;
+                                 }
+                                 previous = it;
+                             }
+                             bounds[index] = { std::move(first), std::move(previous) };
+                         });
+        if (!sorted.load()) {
+            return false;
+        }
+
+        const Iterator* previousLast = nullptr;
+        for (const auto& bound : bounds) {
+            if (bound.first == end) {
+                continue;
+            }
+            if (previousLast != nullptr && compare(*bound.first, **previousLast)) {
+                return false;
+            }
+            previousLast = &bound.second;
+        }
+        return true;
+    }
+    else {
+        return std::is_sorted(begin, end, std::move(compare));
+    }
+}
+
+// Sorts every partition, after which neighbouring partitions are merged pairwise, in rounds, until one partition is left
+template<class Execution, class Iterator, class Compare>
+void executeSort(Execution execution, const Iterator& begin, const Iterator& end, Compare compare) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        std::sort(execution, begin, end, std::move(compare));
+    }
+    else {
+        const auto parts = partitionCount(execution);
+        const auto boundary = [&begin, &end, parts](const std::size_t index) {
+            return index >= parts ? end : Partitioner<Iterator>::slice(begin, end, index, parts).first;
+        };
+        forEachPartition(execution, begin, end, parts, [&compare](Iterator first, Iterator last, std::size_t) {
+            std::sort(std::move(first), std::move(last), compare);
+        });
+        for (std::size_t width = 1; width < parts; width *= 2) {
+            const std::size_t merges = (parts - width + 2 * width - 1) / (2 * width);
+            forEachIndex(execution, merges, [&boundary, &compare, width](const std::size_t index) {
+                const std::size_t first = index * 2 * width;
+                std::inplace_merge(boundary(first), boundary(first + width), boundary(first + 2 * width), compare);
+            });
+        }
+    }
+}
+
+template<class Execution, class Iterator, class OutputIterator>
+OutputIterator executeCopy(Execution execution, const Iterator& begin, const Iterator& end, OutputIterator output) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::copy(execution, begin, end, std::move(output));
+    }
+    else if constexpr (IsRandomAccess<Iterator>::value && IsRandomAccess<OutputIterator>::value) {
+        forEachPartition(execution, begin, end, partitionCount(execution),
+                         [&begin, &output](Iterator first, Iterator last, std::size_t) {
+                             auto offset = static_cast<DiffType<OutputIterator>>(first - begin);
+                             std::copy(std::move(first), std::move(last), output + offset);
+                         });
+        return output + static_cast<DiffType<OutputIterator>>(end - begin);
+    }
+    else if constexpr (Partitioner<Iterator>::value) {
+        return partitionedCopy(execution, begin, end, std::move(output));
+    }
+    else {
+        return std::copy(begin, end, std::move(output));
+    }
+}
+
+template<class Execution, class Iterator, class OutputIterator, class UnaryFunc>
+OutputIterator
+executeTransform(Execution execution, const Iterator& begin, const Iterator& end, OutputIterator output, UnaryFunc func) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::transform(execution, begin, end, std::move(output), std::move(func));
+    }
+    else if constexpr (IsRandomAccess<Iterator>::value && IsRandomAccess<OutputIterator>::value) {
+        forEachPartition(execution, begin, end, partitionCount(execution),
+                         [&begin, &output, &func](Iterator first, Iterator last, std::size_t) {
+                             auto offset = static_cast<DiffType<OutputIterator>>(first - begin);
+                             std::transform(std::move(first), std::move(last), output + offset, func);
+                         });
+        return output + static_cast<DiffType<OutputIterator>>(end - begin);
+    }
+    else {
+        return std::transform(begin, end, std::move(output), std::move(func));
+    }
+}
+
+template<class Execution, class IteratorA, class IteratorB, class BinaryPredicate>
+bool executeEqual(Execution execution, const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB,
+                  const IteratorB& endB, BinaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::equal(execution, beginA, endA, beginB, endB, std::move(predicate));
+    }
+    else if constexpr (IsRandomAccess<IteratorA>::value && IsRandomAccess<IteratorB>::value) {
+        if (endA - beginA != endB - beginB) {
+            return false;
+        }
+        std::atomic<bool> equal{ true };
+        forEachPartition(execution, beginA, endA, partitionCount(execution),
+                         [&equal, &beginA, &beginB, &predicate](IteratorA first, IteratorA last, std::size_t) {
+                             if (!equal.load(std::memory_order_relaxed)) {
+                                 return;
+                             }
+                             auto offset = static_cast<DiffType<IteratorB>>(first - beginA);
+                             if (!std::equal(std::move(first), std::move(last), beginB + offset, predicate)) {
+                                 equal.store(false, std::memory_order_relaxed);
+                             }
+                         });
+        return equal.load();
+    }
+    else {
+        return std::equal(beginA, endA, beginB, endB, std::move(predicate));
+    }
+}
+
+template<class Execution, class Iterator, class Compare>
+void executeNthElement(Execution execution, const Iterator& begin, const Iterator& nth, const Iterator& end, Compare compare) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        std::nth_element(execution, begin, nth, end, std::move(compare));
+    }
+    else {
+        static_cast<void>(execution);
+        std::nth_element(begin, nth, end, std::move(compare));
+    }
+}
+
+template<class Execution, class IteratorA, class IteratorB, class BinaryPredicate>
+IteratorA executeSearch(Execution execution, const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB,
+                        const IteratorB& endB, BinaryPredicate predicate) {
+    if constexpr (!IsPoolPolicy<Execution>::value) {
+        return std::search(execution, beginA, endA, beginB, endB, std::move(predicate));
+    }
+    else {
+        static_cast<void>(execution);
+        return std::search(beginA, endA, beginB, endB, std::move(predicate));
+    }
+}
+#endif // LZ_HAS_EXECUTION
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_HPP
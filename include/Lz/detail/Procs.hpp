@@ -7,8 +7,11 @@
 #include "Lz/detail/FunctionContainer.hpp"
 #include "Lz/detail/Traits.hpp"
 
+#include <algorithm>
 #include <array> // std::get
+#include <tuple>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 
@@ -29,6 +32,10 @@
 #endif
 
 namespace lz {
+namespace execution {
+class PoolPolicy;
+} // namespace execution
+
 namespace detail {
 
 [[noreturn]] inline void assertionFail(const char* file, const int line, const char* func, const char* message) {
@@ -123,16 +130,53 @@ LZ_CONSTEXPR_CXX_14 Result roundEven(const Arithmetic a, const Arithmetic b) noe
     return static_cast<Result>(a / b) + 1;
 }
 
-template<class Iter>
-DiffType<Iter> sizeHint(Iter first, Iter last) {
-    if LZ_CONSTEXPR_IF (IsRandomAccess<Iter>::value) {
-        return std::distance(std::move(first), std::move(last));
+// Advances `iterator` by at most `count` steps without passing `end`
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<Iterator>::value>
+advanceAtMost(Iterator& iterator, const Iterator& end, const DiffType<Iterator> count) {
+    const auto remaining = end - iterator;
+    iterator += remaining < count ? remaining : count;
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_14 EnableIf<!IsRandomAccess<Iterator>::value>
+advanceAtMost(Iterator& iterator, const Iterator& end, DiffType<Iterator> count) {
+    for (; count > 0 && iterator != end; --count) {
+        ++iterator;
     }
-    else {
-        return 0;
+}
+
+/**
+ * Returns the first element in [first, last) for which `predicate` returns false, where `predicate` must be true for a prefix of
+ * the range only. Uses exponentially growing steps followed by a binary search, so that skipping `n` elements takes O(log n)
+ * comparisons instead of O(n), while the answer is found in O(1) if it is close to `first`.
+ */
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 Iterator gallop(Iterator first, const Iterator& last, UnaryPredicate predicate) {
+    DiffType<Iterator> step = 1;
+    while (first != last && predicate(*first)) {
+        Iterator probe = first;
+        advanceAtMost(probe, last, step);
+        if (probe == last || !predicate(*probe)) {
+            return std::partition_point(std::next(first), std::move(probe), predicate);
+        }
+        first = std::move(probe);
+        step *= 2;
     }
+    return first;
+}
+
+// Finalizer of splitmix64. std::hash is the identity for integers on most implementations, which clusters keys that only differ
+// in their high bits
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 std::uint64_t mixHash(std::uint64_t hash) noexcept {
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
 }
 
+template<class T>
+struct IsPoolPolicy : std::is_same<T, execution::PoolPolicy> {};
+
 #ifdef LZ_HAS_EXECUTION
 template<class T>
 struct IsSequencedPolicy : std::is_same<T, std::execution::sequenced_policy> {};
@@ -148,7 +192,8 @@ constexpr bool IsForwardOrStrongerV = IsForwardOrStronger<T>::value;
 
 template<class Execution, class Iterator>
 constexpr bool isCompatibleForExecution() {
-    static_assert(std::is_execution_policy_v<Execution>, "Execution must be of type std::execution::*...");
+    static_assert(std::is_execution_policy_v<Execution> || IsPoolPolicy<Execution>::value,
+                  "Execution must be of type std::execution::* or lz::execution::PoolPolicy...");
     constexpr bool isSequenced = IsSequencedPolicyV<Execution>;
     if constexpr (!isSequenced) {
         static_assert(IsForwardOrStrongerV<Iterator>,
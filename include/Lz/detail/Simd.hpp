@@ -0,0 +1,352 @@
+#pragma once
+
+#ifndef LZ_SIMD_HPP
+#define LZ_SIMD_HPP
+
+#include "Lz/Predicates.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LZ_HAS_SIMD
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LZ_HAS_SIMD
+#endif
+
+#if defined(LZ_HAS_SIMD) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace lz {
+namespace detail {
+/**
+ * The SIMD operations on `Width` elements of type `T` at once, in 256 bit registers if AVX2 is enabled and in 128 bit registers
+ * otherwise. Every specialization can load, broadcast, compare and combine elements and turn a comparison into a bit mask with
+ * one bit per element, which is what the filters need. The floating point specializations can also store, add, min and max,
+ * which is what the arithmetic kernels need. Not specialized for types (or targets) that are not vectorized.
+ */
+template<class T>
+struct SimdOps {
+    static constexpr bool Supported = false;
+};
+
+#ifdef LZ_HAS_SIMD
+inline unsigned countTrailingZeros(const unsigned mask) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+#if defined(__AVX2__)
+template<>
+struct SimdOps<float> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 8;
+    using Vec = __m256;
+
+    static Vec load(const float* data) noexcept {
+        return _mm256_loadu_ps(data);
+    }
+
+    static Vec broadcast(const float value) noexcept {
+        return _mm256_set1_ps(value);
+    }
+
+    static void store(float* data, const Vec value) noexcept {
+        _mm256_storeu_ps(data, value);
+    }
+
+    static Vec add(const Vec a, const Vec b) noexcept {
+        return _mm256_add_ps(a, b);
+    }
+
+    // Returns `b` if either operand is NaN, which is `a < b ? a : b`
+    static Vec min(const Vec a, const Vec b) noexcept {
+        return _mm256_min_ps(a, b);
+    }
+
+    static Vec max(const Vec a, const Vec b) noexcept {
+        return _mm256_max_ps(a, b);
+    }
+
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+               : Op == pred::CompareOp::LessEqual    ? _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+               : Op == pred::CompareOp::Greater      ? _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+               : Op == pred::CompareOp::GreaterEqual ? _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+               : Op == pred::CompareOp::Equal        ? _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+                                                     : _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm256_and_ps(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm256_or_ps(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(mask));
+    }
+};
+
+template<>
+struct SimdOps<double> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 4;
+    using Vec = __m256d;
+
+    static Vec load(const double* data) noexcept {
+        return _mm256_loadu_pd(data);
+    }
+
+    static Vec broadcast(const double value) noexcept {
+        return _mm256_set1_pd(value);
+    }
+
+    static void store(double* data, const Vec value) noexcept {
+        _mm256_storeu_pd(data, value);
+    }
+
+    static Vec add(const Vec a, const Vec b) noexcept {
+        return _mm256_add_pd(a, b);
+    }
+
+    // Returns `b` if either operand is NaN, which is `a < b ? a : b`
+    static Vec min(const Vec a, const Vec b) noexcept {
+        return _mm256_min_pd(a, b);
+    }
+
+    static Vec max(const Vec a, const Vec b) noexcept {
+        return _mm256_max_pd(a, b);
+    }
+
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm256_cmp_pd(a, b, _CMP_LT_OQ)
+               : Op == pred::CompareOp::LessEqual    ? _mm256_cmp_pd(a, b, _CMP_LE_OQ)
+               : Op == pred::CompareOp::Greater      ? _mm256_cmp_pd(a, b, _CMP_GT_OQ)
+               : Op == pred::CompareOp::GreaterEqual ? _mm256_cmp_pd(a, b, _CMP_GE_OQ)
+               : Op == pred::CompareOp::Equal        ? _mm256_cmp_pd(a, b, _CMP_EQ_OQ)
+                                                     : _mm256_cmp_pd(a, b, _CMP_NEQ_UQ);
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm256_and_pd(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm256_or_pd(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_pd(mask));
+    }
+};
+
+template<>
+struct SimdOps<std::int32_t> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 8;
+    using Vec = __m256i;
+
+    static Vec load(const std::int32_t* data) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    static Vec broadcast(const std::int32_t value) noexcept {
+        return _mm256_set1_epi32(value);
+    }
+
+    // Only greater than and equal exist for integers, the other comparisons are derived from them
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm256_cmpgt_epi32(b, a)
+               : Op == pred::CompareOp::LessEqual    ? invert(_mm256_cmpgt_epi32(a, b))
+               : Op == pred::CompareOp::Greater      ? _mm256_cmpgt_epi32(a, b)
+               : Op == pred::CompareOp::GreaterEqual ? invert(_mm256_cmpgt_epi32(b, a))
+               : Op == pred::CompareOp::Equal        ? _mm256_cmpeq_epi32(a, b)
+                                                     : invert(_mm256_cmpeq_epi32(a, b));
+    }
+
+    static Vec invert(const Vec mask) noexcept {
+        return _mm256_xor_si256(mask, _mm256_set1_epi32(-1));
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm256_and_si256(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm256_or_si256(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+    }
+};
+#else  // ^^^ AVX2 vvv SSE2
+template<>
+struct SimdOps<float> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 4;
+    using Vec = __m128;
+
+    static Vec load(const float* data) noexcept {
+        return _mm_loadu_ps(data);
+    }
+
+    static Vec broadcast(const float value) noexcept {
+        return _mm_set1_ps(value);
+    }
+
+    static void store(float* data, const Vec value) noexcept {
+        _mm_storeu_ps(data, value);
+    }
+
+    static Vec add(const Vec a, const Vec b) noexcept {
+        return _mm_add_ps(a, b);
+    }
+
+    // Returns `b` if either operand is NaN, which is `a < b ? a : b`
+    static Vec min(const Vec a, const Vec b) noexcept {
+        return _mm_min_ps(a, b);
+    }
+
+    static Vec max(const Vec a, const Vec b) noexcept {
+        return _mm_max_ps(a, b);
+    }
+
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm_cmplt_ps(a, b)
+               : Op == pred::CompareOp::LessEqual    ? _mm_cmple_ps(a, b)
+               : Op == pred::CompareOp::Greater      ? _mm_cmpgt_ps(a, b)
+               : Op == pred::CompareOp::GreaterEqual ? _mm_cmpge_ps(a, b)
+               : Op == pred::CompareOp::Equal        ? _mm_cmpeq_ps(a, b)
+                                                     : _mm_cmpneq_ps(a, b);
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm_and_ps(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm_or_ps(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(mask));
+    }
+};
+
+template<>
+struct SimdOps<double> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 2;
+    using Vec = __m128d;
+
+    static Vec load(const double* data) noexcept {
+        return _mm_loadu_pd(data);
+    }
+
+    static Vec broadcast(const double value) noexcept {
+        return _mm_set1_pd(value);
+    }
+
+    static void store(double* data, const Vec value) noexcept {
+        _mm_storeu_pd(data, value);
+    }
+
+    static Vec add(const Vec a, const Vec b) noexcept {
+        return _mm_add_pd(a, b);
+    }
+
+    // Returns `b` if either operand is NaN, which is `a < b ? a : b`
+    static Vec min(const Vec a, const Vec b) noexcept {
+        return _mm_min_pd(a, b);
+    }
+
+    static Vec max(const Vec a, const Vec b) noexcept {
+        return _mm_max_pd(a, b);
+    }
+
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm_cmplt_pd(a, b)
+               : Op == pred::CompareOp::LessEqual    ? _mm_cmple_pd(a, b)
+               : Op == pred::CompareOp::Greater      ? _mm_cmpgt_pd(a, b)
+               : Op == pred::CompareOp::GreaterEqual ? _mm_cmpge_pd(a, b)
+               : Op == pred::CompareOp::Equal        ? _mm_cmpeq_pd(a, b)
+                                                     : _mm_cmpneq_pd(a, b);
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm_and_pd(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm_or_pd(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm_movemask_pd(mask));
+    }
+};
+
+template<>
+struct SimdOps<std::int32_t> {
+    static constexpr bool Supported = true;
+    static constexpr std::size_t Width = 4;
+    using Vec = __m128i;
+
+    static Vec load(const std::int32_t* data) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    static Vec broadcast(const std::int32_t value) noexcept {
+        return _mm_set1_epi32(value);
+    }
+
+    // Only less than, greater than and equal exist for integers, the other comparisons are derived from them
+    template<pred::CompareOp Op>
+    static Vec compare(const Vec a, const Vec b) noexcept {
+        return Op == pred::CompareOp::Less           ? _mm_cmplt_epi32(a, b)
+               : Op == pred::CompareOp::LessEqual    ? invert(_mm_cmpgt_epi32(a, b))
+               : Op == pred::CompareOp::Greater      ? _mm_cmpgt_epi32(a, b)
+               : Op == pred::CompareOp::GreaterEqual ? invert(_mm_cmplt_epi32(a, b))
+               : Op == pred::CompareOp::Equal        ? _mm_cmpeq_epi32(a, b)
+                                                     : invert(_mm_cmpeq_epi32(a, b));
+    }
+
+    static Vec invert(const Vec mask) noexcept {
+        return _mm_xor_si128(mask, _mm_set1_epi32(-1));
+    }
+
+    static Vec both(const Vec a, const Vec b) noexcept {
+        return _mm_and_si128(a, b);
+    }
+
+    static Vec either(const Vec a, const Vec b) noexcept {
+        return _mm_or_si128(a, b);
+    }
+
+    static unsigned bits(const Vec mask) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask)));
+    }
+};
+#endif // defined(__AVX2__)
+#endif // LZ_HAS_SIMD
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_SIMD_HPP
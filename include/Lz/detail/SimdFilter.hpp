@@ -0,0 +1,92 @@
+#pragma once
+
+#ifndef LZ_SIMD_FILTER_HPP
+#define LZ_SIMD_FILTER_HPP
+
+#include "Lz/Predicates.hpp"
+#include "Lz/detail/Simd.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <cstddef>
+
+namespace lz {
+namespace detail {
+// Whether `Predicate` can be evaluated on `Width` elements of type `T` at once
+template<class Predicate, class T>
+struct IsSimdPredicate : std::false_type {};
+
+template<pred::CompareOp Op, class T>
+struct IsSimdPredicate<pred::Compare<Op, T>, T> : std::integral_constant<bool, SimdOps<T>::Supported> {};
+
+template<class T>
+struct IsSimdPredicate<pred::Between<T>, T> : std::integral_constant<bool, SimdOps<T>::Supported> {};
+
+template<class Left, class Right, class T>
+struct IsSimdPredicate<pred::And<Left, Right>, T>
+    : std::integral_constant<bool, IsSimdPredicate<Left, T>::value && IsSimdPredicate<Right, T>::value> {};
+
+template<class Left, class Right, class T>
+struct IsSimdPredicate<pred::Or<Left, Right>, T>
+    : std::integral_constant<bool, IsSimdPredicate<Left, T>::value && IsSimdPredicate<Right, T>::value> {};
+
+#ifdef LZ_HAS_SIMD
+template<class Ops, pred::CompareOp Op, class T>
+typename Ops::Vec simdMask(const pred::Compare<Op, T>& predicate, const typename Ops::Vec elements) noexcept {
+    return Ops::template compare<Op>(elements, Ops::broadcast(predicate.value));
+}
+
+template<class Ops, class T>
+typename Ops::Vec simdMask(const pred::Between<T>& predicate, const typename Ops::Vec elements) noexcept {
+    return Ops::both(Ops::template compare<pred::CompareOp::GreaterEqual>(elements, Ops::broadcast(predicate.low)),
+                     Ops::template compare<pred::CompareOp::LessEqual>(elements, Ops::broadcast(predicate.high)));
+}
+
+template<class Ops, class Left, class Right>
+typename Ops::Vec simdMask(const pred::And<Left, Right>& predicate, const typename Ops::Vec elements) noexcept {
+    return Ops::both(simdMask<Ops>(predicate.left, elements), simdMask<Ops>(predicate.right, elements));
+}
+
+template<class Ops, class Left, class Right>
+typename Ops::Vec simdMask(const pred::Or<Left, Right>& predicate, const typename Ops::Vec elements) noexcept {
+    return Ops::either(simdMask<Ops>(predicate.left, elements), simdMask<Ops>(predicate.right, elements));
+}
+
+/**
+ * Copies the elements of [data, data + size) for which `predicate` is true into `out`, until `capacity` elements are copied.
+ * `Width` elements are compared at once, after which the matches are compacted by walking the set bits of the mask. Returns the
+ * index of the first match that did not fit anymore, or `size` if all matches were copied. `written` is set to the number of
+ * copied elements.
+ */
+template<class T, class Predicate>
+std::size_t simdFilterCopy(const T* data, const std::size_t size, const Predicate& predicate, T* out, const std::size_t capacity,
+                           std::size_t& written) noexcept {
+    using Ops = SimdOps<T>;
+    written = 0;
+    std::size_t i = 0;
+    for (; i + Ops::Width <= size; i += Ops::Width) {
+        unsigned mask = Ops::bits(simdMask<Ops>(predicate, Ops::load(data + i)));
+        while (mask != 0) {
+            const std::size_t index = i + countTrailingZeros(mask);
+            if (written == capacity) {
+                return index;
+            }
+            out[written++] = data[index];
+            mask &= mask - 1;
+        }
+    }
+    for (; i < size; ++i) {
+        if (!predicate(data[i])) {
+            continue;
+        }
+        if (written == capacity) {
+            return i;
+        }
+        out[written++] = data[i];
+    }
+    return size;
+}
+#endif // LZ_HAS_SIMD
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_SIMD_FILTER_HPP
@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef LZ_SIZE_HINT_HPP
+#define LZ_SIZE_HINT_HPP
+
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace lz {
+namespace detail {
+enum class SizeBound {
+    unknown,
+    upper,
+    exact
+};
+
+/**
+ * The amount of elements a view will yield, without iterating over it. `size` is the exact amount if `bound` is
+ * `SizeBound::exact`, an upper bound if it is `SizeBound::upper` (e.g. a filter) and meaningless if it is `SizeBound::unknown`
+ * (e.g. a regex split or an infinite range).
+ */
+struct SizeHint {
+    std::size_t size;
+    SizeBound bound;
+
+    LZ_NODISCARD constexpr bool isKnown() const noexcept {
+        return bound != SizeBound::unknown;
+    }
+
+    LZ_NODISCARD constexpr bool isExact() const noexcept {
+        return bound == SizeBound::exact;
+    }
+};
+
+LZ_NODISCARD constexpr SizeHint exactSize(const std::size_t size) noexcept {
+    return { size, SizeBound::exact };
+}
+
+LZ_NODISCARD constexpr SizeHint upperBoundSize(const std::size_t size) noexcept {
+    return { size, SizeBound::upper };
+}
+
+LZ_NODISCARD constexpr SizeHint unknownSize() noexcept {
+    return { 0, SizeBound::unknown };
+}
+
+// The amount of elements to reserve room for. Only exact sizes are reserved: an upper bound, e.g. of a filter that rejects nearly
+// everything, may be far larger than the amount of elements
+LZ_NODISCARD constexpr std::size_t reserveSize(const SizeHint hint) noexcept {
+    return hint.isExact() ? hint.size : 0;
+}
+
+// The least precise bound of the two
+LZ_NODISCARD constexpr SizeBound weakestBound(const SizeBound a, const SizeBound b) noexcept {
+    return static_cast<int>(a) < static_cast<int>(b) ? a : b;
+}
+
+// Used by views that may skip elements of the underlying range, such as filter: the exact size becomes an upper bound
+LZ_NODISCARD constexpr SizeHint atMost(const SizeHint hint) noexcept {
+    return { hint.size, weakestBound(hint.bound, SizeBound::upper) };
+}
+
+// Applies `func` to the size while keeping the bound. `func` must be monotonically increasing
+template<class Func>
+LZ_NODISCARD constexpr SizeHint transformSize(const SizeHint hint, Func func) {
+    return { hint.isKnown() ? static_cast<std::size_t>(func(hint.size)) : 0, hint.bound };
+}
+
+// Size of two ranges glued after each other (concatenate)
+LZ_NODISCARD constexpr SizeHint operator+(const SizeHint a, const SizeHint b) noexcept {
+    return { a.size + b.size, weakestBound(a.bound, b.bound) };
+}
+
+// Size of the cartesian product of two ranges
+LZ_NODISCARD constexpr SizeHint operator*(const SizeHint a, const SizeHint b) noexcept {
+    return { a.size * b.size, weakestBound(a.bound, b.bound) };
+}
+
+// Size of two ranges that are iterated until the shortest is exhausted (zip). An unknown size may still be finite (e.g. a
+// generateWhile), so the size of the other range is only an upper bound then
+LZ_NODISCARD constexpr SizeHint minSize(const SizeHint a, const SizeHint b) noexcept {
+    return !a.isKnown()   ? atMost(b)
+           : !b.isKnown() ? atMost(a)
+                          : SizeHint{ a.size < b.size ? a.size : b.size, weakestBound(a.bound, b.bound) };
+}
+
+// Size of two ranges that are iterated until the longest is exhausted (zip longest)
+LZ_NODISCARD constexpr SizeHint maxSize(const SizeHint a, const SizeHint b) noexcept {
+    return { a.size < b.size ? b.size : a.size, weakestBound(a.bound, b.bound) };
+}
+
+template<class Iterator, class = int>
+struct HasSizeHint : std::false_type {};
+
+template<class Iterator>
+struct HasSizeHint<Iterator, decltype((void)std::declval<const Iterator&>().sizeHint(std::declval<const Iterator&>()), 0)>
+    : std::true_type {};
+
+/**
+ * Gets the size of [first, last) without iterating over it. Iterators of this library can report their own size by defining
+ * `SizeHint sizeHint(const Iterator& end) const`, other iterators are only sized if they are random access.
+ */
+template<class Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<HasSizeHint<Iterator>::value, SizeHint>
+getSizeHint(const Iterator& first, const Iterator& last) {
+    return first.sizeHint(last);
+}
+
+template<class Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<!HasSizeHint<Iterator>::value && IsRandomAccess<Iterator>::value, SizeHint>
+getSizeHint(const Iterator& first, const Iterator& last) {
+    return exactSize(static_cast<std::size_t>(last - first));
+}
+
+template<class Iterator>
+LZ_NODISCARD constexpr EnableIf<!HasSizeHint<Iterator>::value && !IsRandomAccess<Iterator>::value, SizeHint>
+getSizeHint(const Iterator&, const Iterator&) {
+    return unknownSize();
+}
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_SIZE_HINT_HPP
@@ -0,0 +1,239 @@
+#pragma once
+
+#ifndef LZ_THREAD_POOL_HPP
+#define LZ_THREAD_POOL_HPP
+
+#include "Lz/detail/CompilerChecks.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * A fixed set of worker threads with a task queue each. A worker runs the most recently queued task of its own queue first, and
+ * steals the oldest task of another queue when its own queue is empty. `run` blocks until all its tasks are done, and the calling
+ * thread runs queued tasks itself while it waits. Because of that, a task may call `run` again (e.g. a parallel `forEach` inside
+ * a parallel `forEach`) without every thread ending up waiting on each other.
+ */
+class ThreadPool {
+    // One call to `run`. Every task decrements `remaining` once it is done; the last one wakes up the caller of `run`
+    struct Batch {
+        void (*invoke)(const void*, std::size_t);
+        const void* func;
+        std::size_t remaining;
+        std::exception_ptr error{};
+        std::mutex mutex{};
+        std::condition_variable done{};
+
+        Batch(void (*invokeFunc)(const void*, std::size_t), const void* function, const std::size_t count) noexcept :
+            invoke(invokeFunc),
+            func(function),
+            remaining(count) {
+        }
+    };
+
+    struct Task {
+        Batch* batch;
+        std::size_t index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    struct Worker {
+        const ThreadPool* pool;
+        std::size_t index;
+    };
+
+    // Set before the workers start, unlike the size of `_threads`, which is still growing while the first workers run
+    std::size_t _queueCount;
+    std::unique_ptr<Queue[]> _queues;
+    std::vector<std::thread> _threads;
+    // The amount of tasks in all queues together. Only changed while holding the lock of the queue that is pushed to/popped from
+    std::atomic<std::size_t> _queued{ 0 };
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    bool _stop{ false };
+
+    // The pool and queue of the current thread, `pool` is nullptr for threads that are not a worker of any pool
+    static Worker& currentWorker() noexcept {
+        static thread_local Worker worker{ nullptr, 0 };
+        return worker;
+    }
+
+    template<class Func>
+    static void invoke(const void* func, const std::size_t index) {
+        (*static_cast<const Func*>(func))(index);
+    }
+
+    static void execute(const Task& task) noexcept {
+        Batch& batch = *task.batch;
+        std::exception_ptr error;
+        try {
+            batch.invoke(batch.func, task.index);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        if (error && !batch.error) {
+            batch.error = std::move(error);
+        }
+        if (--batch.remaining == 0) {
+            batch.done.notify_all();
+        }
+    }
+
+    bool pop(Queue& queue, Task& task, const bool newest) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        if (newest) {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+        }
+        else {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+        _queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool take(const Worker& worker, Task& task) {
+        const bool isOwnWorker = worker.pool == this;
+        if (isOwnWorker && pop(_queues[worker.index], task, true)) {
+            return true;
+        }
+        for (std::size_t i = isOwnWorker ? 1 : 0; i < _queueCount; ++i) {
+            if (pop(_queues[(worker.index + i) % _queueCount], task, false)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(const std::size_t index) {
+        Worker& worker = currentWorker();
+        worker = Worker{ this, index };
+        Task task{};
+        while (true) {
+            if (take(worker, task)) {
+                execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _wake.wait(lock, [this] { return _stop || _queued.load() != 0; });
+            if (_stop && _queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    void push(Queue& queue, const Task& task) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+        _queued.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static bool isDone(Batch& batch) {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        return batch.remaining == 0;
+    }
+
+public:
+    /**
+     * Creates a pool in which `threads` threads work on every call to `run`: the calling thread and `threads - 1` workers.
+     */
+    explicit ThreadPool(const std::size_t threads) :
+        _queueCount(threads == 0 ? 0 : threads - 1),
+        _queues(new Queue[_queueCount]) {
+        _threads.reserve(_queueCount);
+        for (std::size_t i = 0; i < _queueCount; ++i) {
+            _threads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    LZ_NODISCARD std::size_t threadCount() const noexcept {
+        return _queueCount + 1;
+    }
+
+    /**
+     * Calls `func(index)` for every index in [0, count) and returns once all calls are done. The first exception thrown by
+     * `func` is rethrown here, after all other calls are done.
+     */
+    template<class Func>
+    void run(const std::size_t count, const Func& func) {
+        if (count <= 1 || _queueCount == 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+
+        Batch batch(&invoke<Func>, &func, count);
+        const Worker worker = currentWorker();
+        for (std::size_t i = 0; i < count; ++i) {
+            // A worker queues its tasks in its own queue, so that they are run by itself unless another worker is idle
+            push(_queues[worker.pool == this ? worker.index : i % _queueCount], Task{ &batch, i });
+        }
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _wake.notify_all();
+
+        Task task{};
+        while (!isDone(batch)) {
+            if (take(worker, task)) {
+                execute(task);
+                continue;
+            }
+            // All tasks of this batch are taken, so they can only be finished by the threads that took them
+            std::unique_lock<std::mutex> lock(batch.mutex);
+            batch.done.wait(lock, [&batch] { return batch.remaining == 0; });
+        }
+
+        if (batch.error) {
+            std::rethrow_exception(batch.error);
+        }
+    }
+};
+
+/**
+ * The pool that is used by `lz::execution::pool()`. It is created on first use with one thread per hardware thread and never
+ * destroyed: its workers are not joined at exit, so it can still be used by the destructors of static objects.
+ */
+inline ThreadPool& defaultPool() {
+    static ThreadPool* const pool = new ThreadPool(std::thread::hardware_concurrency());
+    return *pool;
+}
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_THREAD_POOL_HPP
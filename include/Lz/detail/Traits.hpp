@@ -124,6 +124,12 @@ struct IsAllSame : std::integral_constant<bool, std::is_same<T, U>::value && IsA
 template<class T, class U>
 struct IsAllSame<T, U> : std::is_same<T, U> {};
 
+template<bool... Bs>
+struct IsAllTrue : std::true_type {};
+
+template<bool B, bool... Bs>
+struct IsAllTrue<B, Bs...> : std::integral_constant<bool, B && IsAllTrue<Bs...>::value> {};
+
 template<class IterTag>
 struct IsBidirectionalTag : std::is_convertible<IterTag, std::bidirectional_iterator_tag> {};
 
@@ -3,8 +3,10 @@
 #ifndef LZ_ANY_VIEW_HELPERS_HPP
 #define LZ_ANY_VIEW_HELPERS_HPP
 
-#include "Lz/detail/iterators/anyview/IteratorBase.hpp"
+#include "Lz/detail/Traits.hpp"
+#include "Lz/detail/iterators/anyview/AnyIteratorImpl.hpp"
 
+#include <cstddef>
 #include <iterator>
 
 namespace lz {
@@ -12,8 +14,18 @@ namespace detail {
 
 template<class T, class Reference, class IterCat, class DiffType>
 class IteratorWrapper {
-    using AnyIteratorBase = IteratorBase<Reference, IterCat, DiffType>;
-    std::shared_ptr<AnyIteratorBase> _ptr{ nullptr };
+    using VTable = AnyIteratorVTable<Reference, DiffType>;
+
+    // Iterators that fit are stored inline, so copying an iterator does not allocate
+    AnyIteratorStorage _storage;
+    const VTable* _vtable{ nullptr };
+
+    void reset() noexcept {
+        if (_vtable != nullptr) {
+            _vtable->destroy(_storage);
+            _vtable = nullptr;
+        }
+    }
 
 public:
     using value_type = T;
@@ -22,49 +34,86 @@ public:
     using difference_type = DiffType;
     using iterator_category = IterCat;
 
+    // See `HasBatchedPull`, void if the elements cannot be batched
+    using BatchSlot = typename VTable::BatchSlot;
+
     IteratorWrapper() = default;
 
-    IteratorWrapper(const std::shared_ptr<AnyIteratorBase>& ptr) : _ptr(ptr->clone()) {
+    template<class Iter, class = EnableIf<!std::is_same<Decay<Iter>, IteratorWrapper>::value>>
+    explicit IteratorWrapper(Iter&& iter) :
+        _vtable(AnyIteratorImpl<Decay<Iter>, Reference, IterCat, DiffType>::construct(_storage, std::forward<Iter>(iter))) {
     }
 
-    IteratorWrapper(std::shared_ptr<AnyIteratorBase>&& ptr) : _ptr(std::move(ptr)) {
+    IteratorWrapper(const IteratorWrapper& other) : _vtable(other._vtable) {
+        if (_vtable != nullptr) {
+            _vtable->copy(other._storage, _storage);
+        }
     }
 
-    IteratorWrapper(const IteratorWrapper& other) : _ptr(other._ptr->clone()) {
+    IteratorWrapper(IteratorWrapper&& other) noexcept : _vtable(other._vtable) {
+        if (_vtable != nullptr) {
+            _vtable->move(other._storage, _storage);
+            other._vtable = nullptr;
+        }
     }
 
     IteratorWrapper& operator=(const IteratorWrapper& other) {
         if (this != &other) {
-            _ptr = other._ptr->clone();
+            reset();
+            if (other._vtable != nullptr) {
+                other._vtable->copy(other._storage, _storage);
+                _vtable = other._vtable;
+            }
         }
         return *this;
     }
 
-    IteratorWrapper& operator=(std::shared_ptr<AnyIteratorBase>&& ptr) {
-        if (_ptr != ptr) {
-            _ptr = std::move(ptr);
+    IteratorWrapper& operator=(IteratorWrapper&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other._vtable != nullptr) {
+                other._vtable->move(other._storage, _storage);
+                _vtable = other._vtable;
+                other._vtable = nullptr;
+            }
         }
         return *this;
     }
 
+    ~IteratorWrapper() {
+        reset();
+    }
+
+    // Copies at most `n` elements into `out` with a single call to the erased iterator, see `HasBatchedPull`
+    std::size_t pull(const IteratorWrapper& end, BatchSlot* out, const std::size_t n) {
+        return _vtable->pull(_storage, end._storage, out, n);
+    }
+
+    // See `HasContiguousData`, void if the elements cannot be contiguous
+    using ContiguousElement = typename VTable::ContiguousElement;
+
+    ContiguousElement* contiguousData(const IteratorWrapper& end, std::size_t& size) const {
+        return _vtable->contiguousData == nullptr ? nullptr : _vtable->contiguousData(_storage, end._storage, size);
+    }
+
     reference operator*() {
-        return _ptr->dereference();
+        return _vtable->dereference(_storage);
     }
 
     typename std::add_const<reference>::type operator*() const {
-        return _ptr->dereference();
+        return _vtable->dereference(_storage);
     }
 
     pointer operator->() {
-        return _ptr->arrow();
+        return pointer{ **this };
     }
 
     pointer operator->() const {
-        return _ptr->arrow();
+        return pointer{ **this };
     }
 
     IteratorWrapper& operator++() {
-        _ptr->increment();
+        _vtable->increment(_storage);
         return *this;
     }
 
@@ -75,7 +124,9 @@ public:
     }
 
     IteratorWrapper& operator--() {
-        _ptr->decrement();
+        static_assert(IsBidirectionalTag<IterCat>::value,
+                      "The iterator category of this AnyView must be bidirectional or stronger");
+        _vtable->decrement(_storage);
         return *this;
     }
 
@@ -90,11 +141,12 @@ public:
     }
 
     bool operator==(const IteratorWrapper& other) const {
-        return _ptr->eq(*other._ptr);
+        return _vtable->eq(_storage, other._storage);
     }
 
     bool operator<(const IteratorWrapper& other) const {
-        return _ptr->lt(*other._ptr);
+        static_assert(IsRandomAccessTag<IterCat>::value, "The iterator category of this AnyView must be random access");
+        return _vtable->lt(_storage, other._storage);
     }
 
     bool operator>(const IteratorWrapper& other) const {
@@ -110,7 +162,8 @@ public:
     }
 
     IteratorWrapper& operator+=(const DiffType n) {
-        _ptr->plusIs(n);
+        static_assert(IsRandomAccessTag<IterCat>::value, "The iterator category of this AnyView must be random access");
+        _vtable->plusIs(_storage, n);
         return *this;
     }
 
@@ -120,7 +173,8 @@ public:
     }
 
     DiffType operator-(const IteratorWrapper& other) const {
-        return _ptr->minus(*other._ptr);
+        static_assert(IsRandomAccessTag<IterCat>::value, "The iterator category of this AnyView must be random access");
+        return _vtable->minus(_storage, other._storage);
     }
 
     IteratorWrapper operator-(const DiffType n) const {
@@ -131,7 +185,7 @@ public:
 
     IteratorWrapper operator+(const DiffType n) const {
         IteratorWrapper temp = *this;
-        temp._ptr->plusIs(n);
+        temp += n;
         return temp;
     }
 
@@ -147,4 +201,4 @@ public:
 } // namespace detail
 } // namespace lz
 
-#endif // LZ_ANY_VIEW_HELPERS_HPP
\ No newline at end of file
+#endif // LZ_ANY_VIEW_HELPERS_HPP
@@ -6,6 +6,8 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/Traits.hpp"
 
+#include <string>
+
 namespace lz {
 namespace detail {
 template<class C, bool IsRandomAccess>
@@ -20,6 +22,9 @@ public:
     using pointer = const C*;
     using reference = const C&;
 
+    // The end of a C string is only known once the terminator is found, see `HasContiguousData`
+    using ContiguousElement = const C;
+
     constexpr CStringIterator(const C* it) noexcept : _it(it) {
     }
 
@@ -60,6 +65,14 @@ public:
         return _it - b._it;
     }
 
+    LZ_NODISCARD const C* contiguousData(const CStringIterator& end, std::size_t& size) const {
+        if (_it == nullptr) {
+            return nullptr;
+        }
+        size = end._it == nullptr ? std::char_traits<C>::length(_it) : static_cast<std::size_t>(end._it - _it);
+        return size == 0 ? nullptr : _it;
+    }
+
     LZ_NODISCARD constexpr explicit operator bool() const noexcept {
         return _it != nullptr && *_it != '\0';
     }
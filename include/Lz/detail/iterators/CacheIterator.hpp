@@ -0,0 +1,202 @@
+#pragma once
+
+#ifndef LZ_CACHE_ITERATOR_HPP
+#define LZ_CACHE_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/SizeHint.hpp"
+#include "Lz/detail/Traits.hpp"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * The elements of a cached sequence that were reached so far, shared by all iterators of a `Cache` view. The elements are stored
+ * in chunks of a fixed capacity that are never reallocated, so references to the elements stay valid while the buffer grows.
+ */
+template<class Iterator>
+class CacheBuffer {
+public:
+    using Value = ValueType<Iterator>;
+
+    // About a page per chunk
+    static constexpr std::size_t ChunkSize = sizeof(Value) >= 4096 ? 1 : 4096 / sizeof(Value);
+
+private:
+    // The next element of the sequence that is not buffered yet
+    Iterator _next{};
+    Iterator _end{};
+    std::vector<std::vector<Value>> _chunks{};
+    std::size_t _size{};
+
+    void append() {
+        if (_chunks.empty() || _chunks.back().size() == ChunkSize) {
+            _chunks.emplace_back();
+            _chunks.back().reserve(ChunkSize);
+        }
+        _chunks.back().emplace_back(*_next);
+        ++_next;
+        ++_size;
+    }
+
+public:
+    CacheBuffer(Iterator begin, Iterator end) : _next(std::move(begin)), _end(std::move(end)) {
+    }
+
+    // Buffers the elements up to and including the `index`th one, returns false if the sequence has fewer elements
+    bool reach(const std::size_t index) {
+        while (_size <= index) {
+            if (_next == _end) {
+                return false;
+            }
+            append();
+        }
+        return true;
+    }
+
+    // Buffers all elements and returns how many there are
+    std::size_t fill() {
+        while (_next != _end) {
+            append();
+        }
+        return _size;
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+
+    LZ_NODISCARD const Value& operator[](const std::size_t index) const {
+        return _chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    LZ_NODISCARD SizeHint remaining(const std::size_t index) const {
+        return exactSize(index < _size ? _size - index : 0) + getSizeHint(_next, _end);
+    }
+};
+
+template<class Iterator>
+class CacheIterator : public IterBase<CacheIterator<Iterator>, const ValueType<Iterator>&, const ValueType<Iterator>*,
+                                      DiffType<Iterator>, std::bidirectional_iterator_tag> {
+    using Buffer = CacheBuffer<Iterator>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename Buffer::Value;
+    using difference_type = DiffType<Iterator>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    // The index of the end iterator is only known once all elements are buffered
+    static constexpr std::size_t endIndex() noexcept {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+private:
+    // Owned by the view
+    std::shared_ptr<Buffer> _buffer{};
+    std::size_t _index{};
+
+    bool atEnd() const {
+        return _index == endIndex() || !_buffer->reach(_index);
+    }
+
+public:
+    constexpr CacheIterator() = default;
+
+    CacheIterator(std::shared_ptr<Buffer> buffer, const std::size_t index) : _buffer(std::move(buffer)), _index(index) {
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        _buffer->reach(_index);
+        return (*_buffer)[_index];
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return std::addressof(dereference());
+    }
+
+    void increment() noexcept {
+        ++_index;
+    }
+
+    void decrement() {
+        if (_index == endIndex()) {
+            _index = _buffer->fill();
+        }
+        --_index;
+    }
+
+    LZ_NODISCARD SizeHint sizeHint(const CacheIterator& /* end */) const {
+        return _index == endIndex() ? exactSize(0) : _buffer->remaining(_index);
+    }
+
+    LZ_NODISCARD bool eq(const CacheIterator& b) const {
+        return _index == b._index || (atEnd() && b.atEnd());
+    }
+};
+
+/**
+ * Iterates a buffer that contains all elements of its sequence. Contrary to `CacheIterator`, it never has to evaluate the
+ * sequence, so it is random access: an element is found using the index of its chunk.
+ */
+template<class Iterator>
+class FilledCacheIterator
+    : public IterBase<FilledCacheIterator<Iterator>, const ValueType<Iterator>&, const ValueType<Iterator>*, DiffType<Iterator>,
+                      std::random_access_iterator_tag> {
+    using Buffer = CacheBuffer<Iterator>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Buffer::Value;
+    using difference_type = DiffType<Iterator>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+private:
+    std::shared_ptr<const Buffer> _buffer{};
+    std::size_t _index{};
+
+public:
+    constexpr FilledCacheIterator() = default;
+
+    FilledCacheIterator(std::shared_ptr<const Buffer> buffer, const std::size_t index) :
+        _buffer(std::move(buffer)),
+        _index(index) {
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        return (*_buffer)[_index];
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return std::addressof(dereference());
+    }
+
+    void increment() noexcept {
+        ++_index;
+    }
+
+    void decrement() noexcept {
+        --_index;
+    }
+
+    void plusIs(const difference_type offset) noexcept {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + offset);
+    }
+
+    LZ_NODISCARD difference_type difference(const FilledCacheIterator& b) const noexcept {
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(b._index);
+    }
+
+    LZ_NODISCARD bool eq(const FilledCacheIterator& b) const noexcept {
+        return _index == b._index;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_CACHE_ITERATOR_HPP
@@ -5,8 +5,11 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
+#include "Lz/detail/Parallel.hpp"
+
 #include <numeric>
 
 namespace lz {
@@ -224,6 +227,12 @@ private:
                                std::multiplies<difference_type>{});
     }
 
+    template<std::size_t... Is>
+    LZ_CONSTEXPR_CXX_20 SizeHint totalSize(IndexSequence<Is...>) const {
+        const SizeHint sizes[] = { getSizeHint(std::get<Is>(_begin), std::get<Is>(_end))... };
+        return std::accumulate(std::begin(sizes), std::end(sizes), exactSize(1), std::multiplies<SizeHint>());
+    }
+
     using IndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
 
     void checkEnd() {
@@ -232,6 +241,9 @@ private:
         }
     }
 
+    template<class, class>
+    friend struct Partitioner;
+
 public:
     constexpr CartesianProductIterator() = default;
 
@@ -264,6 +276,15 @@ public:
         checkEnd();
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const CartesianProductIterator& end) const {
+        if (_iterator == end._iterator) {
+            return exactSize(0);
+        }
+        const auto total = totalSize(IndexSequenceForThis());
+        // The amount of elements that are already visited is only known without iterating at the beginning
+        return _iterator == _begin ? total : atMost(total);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const CartesianProductIterator& other) const {
         return _iterator == other._iterator;
     }
@@ -272,6 +293,39 @@ public:
         return other.distanceImpl(IndexSequenceForThis(), *this);
     }
 };
+
+/**
+ * A cartesian product that is not random access. The first sequence is the outermost loop, so it is split instead: every part
+ * gets the combinations of a slice of the first sequence with all elements of the other sequences.
+ */
+template<class... Iterators>
+struct Partitioner<CartesianProductIterator<Iterators...>,
+                   EnableIf<!IsRandomAccess<CartesianProductIterator<Iterators...>>::value>> {
+    using ProductIt = CartesianProductIterator<Iterators...>;
+    using First = TupleElement<0, std::tuple<Iterators...>>;
+
+    static constexpr bool value = Partitioner<First>::value;
+
+    static std::pair<ProductIt, ProductIt>
+    slice(const ProductIt& begin, const ProductIt& end, const std::size_t index, const std::size_t parts) {
+        if (begin == end) {
+            return { end, end };
+        }
+        auto subRange = Partitioner<First>::slice(std::get<0>(begin._iterator), std::get<0>(end._iterator), index, parts);
+        return { at(begin, end, std::move(subRange.first)), at(begin, end, std::move(subRange.second)) };
+    }
+
+private:
+    // The first combination with `first` as element of the first sequence
+    static ProductIt at(const ProductIt& begin, const ProductIt& end, First first) {
+        if (first == std::get<0>(end._iterator)) {
+            return end;
+        }
+        ProductIt result = begin;
+        std::get<0>(result._iterator) = std::move(first);
+        return result;
+    }
+};
 } // namespace detail
 } // namespace lz
 
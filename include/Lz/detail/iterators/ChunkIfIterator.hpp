@@ -7,6 +7,7 @@
 #include "Lz/detail/BasicIteratorView.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 namespace lz {
 namespace detail {
@@ -23,11 +24,10 @@ class ChunkIfIterator
                       FakePointerProxy<BasicIteratorView<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
 #endif // LZ_HAS_EXECUTION
 
-    Iterator _begin{};
     Iterator _subRangeBegin{};
     Iterator _subRangeEnd{};
     Iterator _end{};
-    mutable FunctionContainer<UnaryPredicate> _predicate{};
+    mutable FunctionStorage<UnaryPredicate> _predicate{};
 #ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution{};
@@ -49,7 +49,7 @@ private:
             return std::find_if(std::move(first), std::move(last), _predicate);
         }
         else {
-            return std::find_if(_execution, std::move(first), std::move(last), _predicate);
+            return detail::executeFindIf(_execution, first, last, _predicate);
         }
 #else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
         return std::find_if(std::move(first), std::move(last), _predicate);
@@ -61,12 +61,12 @@ public:
 
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20
-    ChunkIfIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate predicate, Execution execution) :
+    ChunkIfIterator(Iterator iterator, Iterator /* begin */, Iterator end, FunctionStorage<UnaryPredicate> predicate,
+                    Execution execution) :
 #else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
 
-    ChunkIfIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate predicate) :
+    ChunkIfIterator(Iterator iterator, Iterator /* begin */, Iterator end, FunctionStorage<UnaryPredicate> predicate) :
 #endif // LZ_HAS_EXECUTION
-        _begin(std::move(begin)),
         _subRangeBegin(iterator),
         _subRangeEnd(std::move(iterator)),
         _end(std::move(end)),
@@ -108,6 +108,14 @@ public:
         _subRangeEnd = findNext(_subRangeBegin, _end);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ChunkIfIterator& end) const {
+        if (_subRangeBegin == end._subRangeBegin) {
+            return exactSize(0);
+        }
+        // n elements can be split into at most n + 1 chunks
+        return atMost(transformSize(getSizeHint(_subRangeBegin, end._subRangeBegin), [](const std::size_t n) { return n + 1; }));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ChunkIfIterator& rhs) const {
         return _subRangeBegin == rhs._subRangeBegin;
     }
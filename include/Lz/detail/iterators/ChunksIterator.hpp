@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/BasicIteratorView.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 #include <cmath>
 
@@ -66,6 +67,12 @@ public:
         nextChunk();
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ChunksIterator& end) const {
+        const auto chunkSize = static_cast<std::size_t>(_chunkSize);
+        return transformSize(getSizeHint(_subRangeBegin, end._subRangeBegin),
+                             [chunkSize](const std::size_t n) { return (n + chunkSize - 1) / chunkSize; });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ChunksIterator& rhs) const noexcept {
         LZ_ASSERT(_chunkSize == rhs._chunkSize, "incompatible iterators: different chunk sizes");
         return _subRangeBegin == rhs._subRangeBegin;
@@ -215,6 +222,12 @@ public:
         prevChunk();
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ChunksIterator& end) const {
+        const auto chunkSize = static_cast<std::size_t>(_chunkSize);
+        return transformSize(getSizeHint(_subRangeBegin, end._subRangeBegin),
+                             [chunkSize](const std::size_t n) { return (n + chunkSize - 1) / chunkSize; });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ChunksIterator& rhs) const noexcept {
         LZ_ASSERT(_chunkSize == rhs._chunkSize, "incompatible iterators: different chunk sizes");
         return _subRangeBegin == rhs._subRangeBegin;
@@ -4,9 +4,13 @@
 #define LZ_CONCATENATE_ITERATOR_HPP
 
 #include "Lz/IterBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
+#include "Lz/detail/Parallel.hpp"
+
 #include <numeric>
 
 namespace lz {
@@ -45,6 +49,23 @@ struct NotEqual<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1
     }
 };
 
+template<class Tuple, std::size_t I, class = void>
+struct Segments {
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end, SegmentFunc& func) const {
+        const bool proceed = std::get<I>(iterators) == std::get<I>(end) || func(std::get<I>(iterators), std::get<I>(end));
+        return proceed && Segments<Tuple, I + 1>()(iterators, end, func);
+    }
+};
+
+template<class Tuple, std::size_t I>
+struct Segments<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value>> {
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& /*iterators*/, const Tuple& /*end*/, SegmentFunc& /*func*/) const noexcept {
+        return true;
+    }
+};
+
 template<class Tuple, std::size_t I, class = void>
 struct Deref {
     LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
@@ -137,7 +158,8 @@ struct PlusIs {
 template<class Tuple, std::size_t I>
 struct PlusIs<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
     template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_14 void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
+    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& /*end*/, const DifferenceType offset) const {
+        std::get<I>(iterators) += offset;
     }
 };
 #else
@@ -173,6 +195,23 @@ struct NotEqual {
     }
 };
 
+template<class Tuple, std::size_t I>
+struct Segments {
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end, SegmentFunc& func) const {
+        if constexpr (I == std::tuple_size_v<Decay<Tuple>>) {
+            static_cast<void>(iterators);
+            static_cast<void>(end);
+            static_cast<void>(func);
+            return true;
+        }
+        else {
+            const bool proceed = std::get<I>(iterators) == std::get<I>(end) || func(std::get<I>(iterators), std::get<I>(end));
+            return proceed && Segments<Tuple, I + 1>()(iterators, end, func);
+        }
+    }
+};
+
 template<class Tuple, std::size_t I>
 struct Deref {
     LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
@@ -245,10 +284,8 @@ struct PlusIs {
     template<class DifferenceType>
     LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
         if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(iterators);
             static_cast<void>(end);
-            static_cast<void>(offset);
-            return;
+            std::get<I>(iterators) += offset;
         }
         else {
             using TupElem = TupleElement<I, Tuple>;
@@ -283,6 +320,9 @@ class ConcatenateIterator : public IterBase<ConcatenateIterator<Iterators...>, R
 
     using FirstTupleIterator = std::iterator_traits<FirstIt<Iterators...>>;
 
+    template<class, class>
+    friend struct Partitioner;
+
 public:
     using value_type = typename FirstTupleIterator::value_type;
     using difference_type = CommonType<DiffType<Iterators>...>;
@@ -290,6 +330,10 @@ public:
     using pointer = FakePointerProxy<reference>;
     using iterator_category = CommonType<IterCat<Iterators>...>;
 
+    // Terminal operations loop over one sequence after another, instead of checking which sequence to use per element, see
+    // `HasSegments`
+    using SegmentedIteration = std::true_type;
+
 private:
     template<std::size_t... I>
     LZ_CONSTEXPR_CXX_20 difference_type minus(IndexSequence<I...>, const ConcatenateIterator& other) const {
@@ -298,6 +342,12 @@ private:
         return std::accumulate(std::begin(totals), std::end(totals), difference_type{ 0 });
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(IndexSequence<I...>, const ConcatenateIterator& end) const {
+        const SizeHint sizes[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        return std::accumulate(std::begin(sizes), std::end(sizes), exactSize(0));
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator(IterTuple iterators, IterTuple begin, IterTuple end) :
         _iterators(std::move(iterators)),
@@ -319,6 +369,12 @@ public:
         PlusPlus<IterTuple, 0>()(_iterators, _end);
     }
 
+    // The sequences before the one _iterators is at are already at their end, and the ones after it at their beginning
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segments(const ConcatenateIterator& end, SegmentFunc& func) const {
+        return Segments<IterTuple, 0>()(_iterators, end._iterators, func);
+    }
+
     LZ_CONSTEXPR_CXX_20 void decrement() {
         MinusMinus<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end);
     }
@@ -336,11 +392,79 @@ public:
         return minus(MakeIndexSequence<sizeof...(Iterators)>(), other);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ConcatenateIterator& end) const {
+        return sizeHint(MakeIndexSequence<sizeof...(Iterators)>(), end);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ConcatenateIterator& b) const {
         return !NotEqual<IterTuple, 0>()(_iterators, b._iterators);
     }
 };
 
+/**
+ * A concatenation of sequences that are not all random access. Sequence `I` of a sub range [first, last) is
+ * [get<I>(first), get<I>(last)). If there are at least as many parts as sequences, every sequence is split in its own share of
+ * the parts, so that every part is a slice of one sequence. Otherwise, every part consists of whole sequences. Either way, the
+ * parts stay in order.
+ */
+template<class... Iterators>
+struct Partitioner<ConcatenateIterator<Iterators...>, EnableIf<!IsRandomAccess<ConcatenateIterator<Iterators...>>::value>> {
+    using ConcatIt = ConcatenateIterator<Iterators...>;
+
+    static constexpr bool value = IsAllTrue<Partitioner<Iterators>::value...>::value;
+
+    static std::pair<ConcatIt, ConcatIt>
+    slice(const ConcatIt& begin, const ConcatIt& end, const std::size_t index, const std::size_t parts) {
+        ConcatIt first = begin;
+        ConcatIt last = begin;
+        sliceSequences(MakeIndexSequence<sizeof...(Iterators)>(), first, last, end, index, parts);
+        return { std::move(first), std::move(last) };
+    }
+
+private:
+    template<std::size_t... I>
+    static void sliceSequences(IndexSequence<I...>, ConcatIt& first, ConcatIt& last, const ConcatIt& end, const std::size_t index,
+                               const std::size_t parts) {
+        const bool expander[] = { (sliceSequence<I>(first, last, end, index, parts), true)... };
+        static_cast<void>(expander);
+    }
+
+    // `first` and `last` are copies of the beginning of the range to split
+    template<std::size_t I>
+    static void
+    sliceSequence(ConcatIt& first, ConcatIt& last, const ConcatIt& end, const std::size_t index, const std::size_t parts) {
+        constexpr std::size_t sequences = sizeof...(Iterators);
+        auto& sequenceFirst = std::get<I>(first._iterators);
+        auto& sequenceLast = std::get<I>(last._iterators);
+        const auto& sequenceEnd = std::get<I>(end._iterators);
+
+        if (parts < sequences) {
+            // Part `index` consists of the sequences [index * sequences / parts, (index + 1) * sequences / parts)
+            if (I < index * sequences / parts) {
+                sequenceFirst = sequenceLast = sequenceEnd;
+            }
+            else if (I < (index + 1) * sequences / parts) {
+                sequenceLast = sequenceEnd;
+            }
+            return;
+        }
+
+        // Sequence `I` is split in the parts [partsBegin, partsEnd)
+        const std::size_t partsBegin = I * parts / sequences;
+        const std::size_t partsEnd = (I + 1) * parts / sequences;
+        if (index >= partsEnd) {
+            sequenceFirst = sequenceLast = sequenceEnd;
+        }
+        else if (index >= partsBegin) {
+            using Iterator = TupleElement<I, std::tuple<Iterators...>>;
+            auto subRange = Partitioner<Iterator>::slice(sequenceFirst, sequenceEnd, index - partsBegin, partsEnd - partsBegin);
+            sequenceFirst = std::move(subRange.first);
+            sequenceLast = std::move(subRange.second);
+        }
+        // Otherwise the sequence comes after the part, and stays empty at the beginning of the range to split
+    }
+};
+
 } // namespace detail
 } // namespace lz
 
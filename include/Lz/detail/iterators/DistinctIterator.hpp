@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef LZ_DISTINCT_ITERATOR_HPP
+#define LZ_DISTINCT_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/FlatHashSet.hpp"
+#include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace lz {
+namespace detail {
+// Key selector of `lz::distinct`, the elements themselves are the keys
+struct IdentityKey {
+    template<class T>
+    constexpr T&& operator()(T&& value) const noexcept {
+        return std::forward<T>(value);
+    }
+};
+
+/**
+ * The keys that were seen so far by the iterators of a distinct view, shared by all of them. Next to the keys it stores the
+ * position of every first occurrence, so an iterator that walks a part of the sequence that has already been scanned (a copy of
+ * begin, or a second pass) only has to look up the next position instead of hashing the keys again.
+ */
+template<class Key, class Hash, class KeyEqual>
+struct DistinctState {
+    FlatHashSet<Key, Hash, KeyEqual> seen;
+    // positions[i] is the position in the sequence of the element with key seen[i]
+    std::vector<std::size_t> positions{};
+    // All elements before this position have been scanned
+    std::size_t scanned{};
+
+    DistinctState(Hash hash, KeyEqual keyEqual) : seen(std::move(hash), std::move(keyEqual)) {
+    }
+};
+
+template<class Iterator, class KeySelector, class Hash, class KeyEqual>
+class DistinctIterator : public IterBase<DistinctIterator<Iterator, KeySelector, Hash, KeyEqual>, RefType<Iterator>,
+                                         FakePointerProxy<RefType<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    using State = DistinctState<Decay<FunctionReturnType<KeySelector, reference>>, Hash, KeyEqual>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    // The position of _iterator in the sequence and the index of its key in the set of seen keys
+    std::size_t _position{};
+    std::size_t _index{};
+    // Owned by the view
+    std::shared_ptr<State> _state{};
+    mutable FunctionStorage<KeySelector> _keySelector{};
+
+    void moveTo(const std::size_t position) {
+        std::advance(_iterator, static_cast<difference_type>(position - _position));
+        _position = position;
+    }
+
+    // Moves to the first occurrence of the `_index`th distinct key
+    void find() {
+        State& state = *_state;
+        if (_index < state.positions.size()) {
+            moveTo(state.positions[_index]);
+            return;
+        }
+
+        moveTo(state.scanned);
+        for (; _iterator != _end; ++_iterator, ++_position) {
+            if (state.seen.insert(_keySelector(*_iterator)).second) {
+                state.positions.push_back(_position);
+                state.scanned = _position + 1;
+                return;
+            }
+        }
+        state.scanned = _position;
+    }
+
+public:
+    constexpr DistinctIterator() = default;
+
+    DistinctIterator(Iterator begin, Iterator end, std::shared_ptr<State> state, FunctionStorage<KeySelector> keySelector) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _state(std::move(state)),
+        _keySelector(std::move(keySelector)) {
+        if (_iterator != _end) {
+            find();
+        }
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        ++_index;
+        find();
+    }
+
+    LZ_NODISCARD SizeHint sizeHint(const DistinctIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
+    LZ_NODISCARD bool eq(const DistinctIterator& b) const {
+        return _iterator == b._iterator;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_DISTINCT_ITERATOR_HPP
@@ -5,6 +5,7 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -51,6 +52,10 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const EnumerateIterator& end) const {
+        return getSizeHint(_iterator, end._iterator);
+    }
+
     LZ_CONSTEXPR_CXX_20 bool eq(const EnumerateIterator& other) const {
         return _iterator == other._iterator;
     }
@@ -6,6 +6,9 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include "Lz/detail/Parallel.hpp"
 
 #include <algorithm>
 
@@ -35,28 +38,16 @@ private:
     Iterator _end{};
     IteratorToExcept _toExceptBegin{};
     IteratorToExcept _toExceptEnd{};
-    mutable FunctionContainer<Compare> _compare{};
-#ifdef LZ_HAS_EXECUTION
-    LZ_NO_UNIQUE_ADDRESS
-    Execution _execution{};
-#endif // LZ_HAS_EXECUTION
+    mutable FunctionStorage<Compare> _compare{};
+
+    template<class, class>
+    friend struct Partitioner;
+
     LZ_CONSTEXPR_CXX_20 void find() {
-#ifdef LZ_HAS_EXECUTION
-        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
-            _iterator = std::find_if(std::move(_iterator), _end, [this](const value_type& value) {
-                return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
-            });
-        }
-        else { // NOLINT
-            _iterator = std::find_if(_execution, std::move(_iterator), _end, [this](const value_type& value) {
-                return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
-            });
-        }
-#else  // ^^^ has execution vvv ! has execution
+        // Always sequential: the execution policy is applied once by the terminal operation, see Parallel.hpp
         _iterator = std::find_if(std::move(_iterator), _end, [this](const value_type& value) {
             return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
         });
-#endif // LZ_HAS_EXECUTION
     }
 
 public:
@@ -64,20 +55,16 @@ public:
 
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20 ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
-                                       Compare compare, Execution execution) :
+                                       FunctionStorage<Compare> compare, Execution) :
 #else  // ^^^ has execution vvv ! has execution
-    ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Compare compare) :
+    ExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                   FunctionStorage<Compare> compare) :
 #endif // LZ_HAS_EXECUTION
         _iterator(std::move(begin)),
         _end(std::move(end)),
         _toExceptBegin(std::move(toExceptBegin)),
         _toExceptEnd(std::move(toExceptEnd)),
-        _compare(std::move(compare))
-#ifdef LZ_HAS_EXECUTION
-        ,
-        _execution(execution)
-#endif // LZ_HAS_EXECUTION
-    {
+        _compare(std::move(compare)) {
         if (_toExceptBegin == _toExceptEnd) {
             return;
         }
@@ -97,10 +84,39 @@ public:
         find();
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ExceptIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ExceptIterator& b) const {
         return _iterator == b._iterator;
     }
 };
+
+#ifdef LZ_HAS_EXECUTION
+template<class Iterator, class IteratorToExcept, class Compare, class Execution>
+struct Partitioner<ExceptIterator<Iterator, IteratorToExcept, Compare, Execution>> {
+    using ExceptIt = ExceptIterator<Iterator, IteratorToExcept, Compare, Execution>;
+#else  // ^^^ has execution vvv ! has execution
+template<class Iterator, class IteratorToExcept, class Compare>
+struct Partitioner<ExceptIterator<Iterator, IteratorToExcept, Compare>> {
+    using ExceptIt = ExceptIterator<Iterator, IteratorToExcept, Compare>;
+#endif // LZ_HAS_EXECUTION
+
+    static constexpr bool value = Partitioner<Iterator>::value;
+
+    static std::pair<ExceptIt, ExceptIt>
+    slice(const ExceptIt& begin, const ExceptIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        ExceptIt first = begin;
+        first._iterator = std::move(subRange.first);
+        first._end = subRange.second;
+        first.find();
+        ExceptIt last = first;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
 } // namespace detail
 } // namespace lz
 
@@ -5,6 +5,7 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -62,6 +63,17 @@ public:
         }
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ExcludeIterator& end) const {
+        return transformSize(getSizeHint(_iterator, end._iterator), [this](const std::size_t size) {
+            // Once _index has reached _from, the excluded elements are already skipped
+            if (_index >= _from) {
+                return size;
+            }
+            const auto excludedEnd = (std::min)(_to, _index + static_cast<difference_type>(size));
+            return excludedEnd > _from ? size - static_cast<std::size_t>(excludedEnd - _from) : size;
+        });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ExcludeIterator& b) const noexcept {
         LZ_ASSERT(_to == b._to && _from == b._from, "incompatible iterator types: from and to must be equal");
         return _iterator == b._iterator;
@@ -4,25 +4,91 @@
 #define LZ_FILTER_ITERATOR_HPP
 
 #include "Lz/IterBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/iterators/MapIterator.hpp"
+#include "Lz/detail/SimdFilter.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
-#ifdef LZ_HAS_EXECUTION
-#include "Lz/detail/Procs.hpp"
-#endif
+#include "Lz/detail/Parallel.hpp"
 
 #include <algorithm>
+#include <memory>
 
 namespace lz {
 namespace detail {
+// Filters of other iterators test the predicate on the element and dereference the iterator again when the element is read
+template<class Iterator, class = void>
+class FilterCache {
+public:
+    using reference = RefType<Iterator>;
+
+    template<class UnaryPredicate>
+    static LZ_CONSTEXPR_CXX_20 Iterator find(Iterator first, const Iterator& last, const UnaryPredicate& predicate) {
+        return std::find_if(std::move(first), last, predicate);
+    }
+
+    static LZ_CONSTEXPR_CXX_20 reference get(const Iterator& iterator) {
+        return *iterator;
+    }
+};
+
+/**
+ * A filter of a map that returns its results by value keeps the result it tested the predicate on, so that the function of the
+ * map is called once per element, instead of once for the predicate and once more when the element is read. The element is still
+ * returned by value, as a copy of the kept result, so reading it again or through a copy of the iterator (which copies the kept
+ * result along) does not call the function of the map again.
+ */
+template<class Iterator, class Function>
+class FilterCache<MapIterator<Iterator, Function>,
+                  EnableIf<!std::is_reference<RefType<MapIterator<Iterator, Function>>>::value &&
+                           std::is_default_constructible<ValueType<MapIterator<Iterator, Function>>>::value &&
+                           std::is_copy_constructible<ValueType<MapIterator<Iterator, Function>>>::value &&
+                           std::is_move_assignable<ValueType<MapIterator<Iterator, Function>>>::value>> {
+    using MapIt = MapIterator<Iterator, Function>;
+    using Value = ValueType<MapIt>;
+
+    Value _value{};
+    bool _isCached{ false };
+
+public:
+    using reference = RefType<MapIt>;
+
+    template<class UnaryPredicate>
+    LZ_CONSTEXPR_CXX_20 MapIt find(MapIt first, const MapIt& last, const UnaryPredicate& predicate) {
+        _isCached = false;
+        for (; first != last; ++first) {
+            _value = *first;
+            if (predicate(static_cast<const Value&>(_value))) {
+                _isCached = true;
+                break;
+            }
+        }
+        return first;
+    }
+
+    // Iterators that were not positioned by `find` (e.g. the end of a partition) have nothing kept
+    LZ_CONSTEXPR_CXX_20 reference get(const MapIt& iterator) const {
+        if (!_isCached) {
+            return *iterator;
+        }
+        return _value;
+    }
+};
+
 #ifdef LZ_HAS_EXECUTION
 template<class Iterator, class UnaryPredicate, class Execution>
-class FilterIterator : public IterBase<FilterIterator<Iterator, UnaryPredicate, Execution>, RefType<Iterator>,
-                                       FakePointerProxy<RefType<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
+class FilterIterator
+    : public IterBase<FilterIterator<Iterator, UnaryPredicate, Execution>, typename FilterCache<Iterator>::reference,
+                      FakePointerProxy<typename FilterCache<Iterator>::reference>, DiffType<Iterator>,
+                      std::forward_iterator_tag> {
 #else  // ^^^lz has execution vvv ! lz has execution
 template<class Iterator, class UnaryPredicate>
-class FilterIterator : public IterBase<FilterIterator<Iterator, UnaryPredicate>, RefType<Iterator>,
-                                       FakePointerProxy<RefType<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
+class FilterIterator
+    : public IterBase<FilterIterator<Iterator, UnaryPredicate>, typename FilterCache<Iterator>::reference,
+                      FakePointerProxy<typename FilterCache<Iterator>::reference>, DiffType<Iterator>,
+                      std::forward_iterator_tag> {
 #endif // LZ_HAS_EXECUTION
 
     using IterTraits = std::iterator_traits<Iterator>;
@@ -31,59 +97,62 @@ public:
     using iterator_category = std::forward_iterator_tag;
     using value_type = typename IterTraits::value_type;
     using difference_type = typename IterTraits::difference_type;
-    using reference = typename IterTraits::reference;
+    using reference = typename FilterCache<Iterator>::reference;
     using pointer = FakePointerProxy<reference>;
 
-    template<class I>
-    LZ_CONSTEXPR_CXX_20 I find(I first, I last) {
-#ifdef LZ_HAS_EXECUTION
-        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
-            return std::find_if(std::move(first), std::move(last), _predicate);
-        }
-        else {
-            return std::find_if(_execution, std::move(first), std::move(last), _predicate);
-        }
-#else  // ^^^lz has execution vvv ! lz has execution
-        return std::find_if(std::move(first), std::move(last), _predicate);
-#endif // LZ_HAS_EXECUTION
+    // Filters with a predicate from lz::pred over contiguous arithmetic elements are evaluated with SIMD instructions when they
+    // are materialized, see `HasBatchedPull`
+    using BatchSlot = Conditional<IsContiguousIterator<Iterator>::value && IsSimdPredicate<UnaryPredicate, value_type>::value,
+                                  value_type, void>;
+
+    // Terminal operations loop over the underlying sequence at once, see `HasPush`
+    using PushIteration = std::true_type;
+
+    // Always sequential: the execution policy is applied once by the terminal operation, see Parallel.hpp
+    LZ_CONSTEXPR_CXX_20 Iterator find(Iterator first, const Iterator& last) {
+        return _cache.find(std::move(first), last, _predicate);
     }
 
 private:
-    Iterator _begin{};
     Iterator _iterator{};
     Iterator _end{};
-    mutable FunctionContainer<UnaryPredicate> _predicate{};
-#ifdef LZ_HAS_EXECUTION
+    mutable FunctionStorage<UnaryPredicate> _predicate{};
     LZ_NO_UNIQUE_ADDRESS
-    Execution _execution{};
-#endif // LZ_HAS_EXECUTION
+    FilterCache<Iterator> _cache{};
+
+    template<class, class>
+    friend struct Partitioner;
 
 public:
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20
-    FilterIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate function, Execution execution)
+    FilterIterator(Iterator iterator, Iterator begin, Iterator end, FunctionStorage<UnaryPredicate> function, Execution)
 #else  // ^^^lz has execution vvv ! lz has execution
-    FilterIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate function)
+    FilterIterator(Iterator iterator, Iterator begin, Iterator end, FunctionStorage<UnaryPredicate> function)
 #endif // LZ_HAS_EXECUTION
         :
-        _begin(std::move(begin)),
         _iterator(std::move(iterator)),
         _end(std::move(end)),
-        _predicate(std::move(function))
-#ifdef LZ_HAS_EXECUTION
-        ,
-        _execution(execution)
-#endif // LZ_HAS_EXECUTION
-    {
-        if (_iterator == _begin) {
+        _predicate(std::move(function)) {
+        // Only the beginning is needed, to know whether to search for the first match
+        if (_iterator == begin) {
             _iterator = find(std::move(_iterator), _end);
         }
     }
 
     constexpr FilterIterator() = default;
 
+    // Used to fuse adjacent filters, see Fusion.hpp
+    LZ_NODISCARD constexpr const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD const UnaryPredicate& predicate() const noexcept {
+        return _predicate.function();
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference dereference() const {
-        return *_iterator;
+        return _cache.get(_iterator);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer arrow() const {
@@ -95,10 +164,66 @@ public:
         _iterator = find(std::move(_iterator), _end);
     }
 
+    std::size_t pull(const FilterIterator& end, BatchSlot* out, const std::size_t n) {
+        if (_iterator == end._iterator) {
+            return 0;
+        }
+        std::size_t written = 0;
+        const std::size_t size = static_cast<std::size_t>(end._iterator - _iterator);
+        // _iterator always points to a match, or to the end
+        _iterator += static_cast<difference_type>(
+            simdFilterCopy(std::addressof(*_iterator), size, _predicate.function(), out, n, written));
+        return written;
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool push(const FilterIterator& end, Sink& sink) const {
+        if (_iterator == end._iterator) {
+            return true;
+        }
+        // _iterator already points to a match
+        if (!sink(dereference())) {
+            return false;
+        }
+        auto& predicate = _predicate;
+        auto filterSink = [&predicate, &sink](RefType<Iterator> value) -> bool {
+            return !predicate(value) || sink(std::forward<RefType<Iterator>>(value));
+        };
+        return pushEach(std::next(_iterator), end._iterator, filterSink);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const FilterIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const FilterIterator& b) const noexcept {
         return _iterator == b._iterator;
     }
 };
+
+#ifdef LZ_HAS_EXECUTION
+template<class Iterator, class UnaryPredicate, class Execution>
+struct Partitioner<FilterIterator<Iterator, UnaryPredicate, Execution>> {
+    using FilterIt = FilterIterator<Iterator, UnaryPredicate, Execution>;
+#else  // ^^^lz has execution vvv ! lz has execution
+template<class Iterator, class UnaryPredicate>
+struct Partitioner<FilterIterator<Iterator, UnaryPredicate>> {
+    using FilterIt = FilterIterator<Iterator, UnaryPredicate>;
+#endif // LZ_HAS_EXECUTION
+
+    static constexpr bool value = Partitioner<Iterator>::value;
+
+    static std::pair<FilterIt, FilterIt>
+    slice(const FilterIt& begin, const FilterIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        FilterIt first = begin;
+        first._end = subRange.second;
+        first._iterator = first.find(std::move(subRange.first), subRange.second);
+        FilterIt last = first;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
 } // namespace detail
 } // namespace lz
 
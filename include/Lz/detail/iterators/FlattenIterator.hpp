@@ -4,6 +4,7 @@
 #define LZ_FLATTEN_ITERATOR_HPP
 
 #include "Lz/IterBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 
 namespace lz {
@@ -127,6 +128,16 @@ public:
         return _current == b._current;
     }
 
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segments(const FlattenWrapper& end, SegmentFunc& func) const {
+        return _current == end._current || func(_current, end._current);
+    }
+
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segmentsRest(SegmentFunc& func) const {
+        return _current == _end || func(_current, _end);
+    }
+
     LZ_CONSTEXPR_CXX_20 reference dereference() const {
         return *_current;
     }
@@ -164,6 +175,9 @@ public:
     using iterator_category = CommonType<std::bidirectional_iterator_tag, typename ThisInner::iterator_category>;
     using difference_type = typename ThisInner::difference_type;
 
+    // Terminal operations loop over one inner sequence after another, see `HasSegments`
+    using SegmentedIteration = std::true_type;
+
 private:
     LZ_CONSTEXPR_CXX_20 void advance() {
         if (_innerIter.hasSome()) {
@@ -201,6 +215,52 @@ public:
     LZ_CONSTEXPR_CXX_20 bool hasPrev() const {
         return _innerIter.hasPrev() || _outerIter.hasPrev();
     }
+
+    // The sub ranges up to the end of the outer sequence
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segmentsRest(SegmentFunc& func) const {
+        if (!_outerIter.hasSome()) {
+            return true;
+        }
+        if (!_innerIter.segmentsRest(func)) {
+            return false;
+        }
+        auto outer = _outerIter;
+        for (++outer; outer.hasSome(); ++outer) {
+            auto&& range = *outer;
+            const ThisInner inner(std::begin(range), std::begin(range), std::end(range));
+            if (!inner.segmentsRest(func)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segments(const FlattenIterator& end, SegmentFunc& func) const {
+        if (_outerIter == end._outerIter) {
+            return _innerIter.segments(end._innerIter, func);
+        }
+        if (!_innerIter.segmentsRest(func)) {
+            return false;
+        }
+        auto outer = _outerIter;
+        for (++outer; outer != end._outerIter; ++outer) {
+            auto&& range = *outer;
+            const ThisInner inner(std::begin(range), std::begin(range), std::end(range));
+            if (!inner.segmentsRest(func)) {
+                return false;
+            }
+        }
+        if (!outer.hasSome()) {
+            return true;
+        }
+        // end is in the middle of the last inner sequence
+        auto&& range = *outer;
+        const ThisInner inner(std::begin(range), std::begin(range), std::end(range));
+        return inner.segments(end._innerIter, func);
+    }
+
     LZ_CONSTEXPR_CXX_20 bool eq(const FlattenIterator& b) const noexcept {
         return _outerIter == b._outerIter && _innerIter == b._innerIter;
     }
@@ -251,12 +311,24 @@ public:
     using iterator_category = CommonType<std::bidirectional_iterator_tag, typename Traits::iterator_category>;
     using difference_type = typename Traits::difference_type;
 
+    using SegmentedIteration = std::true_type;
+
     constexpr FlattenIterator() = default;
 
     constexpr FlattenIterator(Iterator it, Iterator begin, Iterator end) :
         _range(std::move(it), std::move(begin), std::move(end)) {
     }
 
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segments(const FlattenIterator& end, SegmentFunc& func) const {
+        return _range.segments(end._range, func);
+    }
+
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 bool segmentsRest(SegmentFunc& func) const {
+        return _range.segmentsRest(func);
+    }
+
     LZ_CONSTEXPR_CXX_20 bool hasPrev() const noexcept {
         return _range.hasPrev();
     }
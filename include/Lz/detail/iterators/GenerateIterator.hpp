@@ -7,6 +7,7 @@
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
 #include "Lz/detail/Procs.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 namespace lz {
 namespace detail {
@@ -51,6 +52,10 @@ public:
         }
     }
 
+    LZ_NODISCARD constexpr SizeHint sizeHint(const GenerateIterator& end) const {
+        return _isWhileTrueLoop ? unknownSize() : exactSize(end._current - _current);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 bool eq(const GenerateIterator& b) const noexcept {
         LZ_ASSERT(_isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return _current == b._current;
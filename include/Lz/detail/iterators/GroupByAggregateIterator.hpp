@@ -0,0 +1,149 @@
+#pragma once
+
+#ifndef LZ_GROUP_BY_AGGREGATE_ITERATOR_HPP
+#define LZ_GROUP_BY_AGGREGATE_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/FlatHashSet.hpp"
+
+#include "Lz/detail/Parallel.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * The aggregate of every distinct key, in the order in which the keys first appear. The keys are stored in a flat hash set, the
+ * aggregate of the key with index `i` in that set is `_aggregates[i]`.
+ */
+template<class Key, class T>
+class GroupAggregateTable {
+    FlatHashSet<Key, std::hash<Key>, MAKE_BIN_OP(std::equal_to, Key)> _keys{};
+    std::vector<T> _aggregates{};
+
+    template<class Iterator, class KeySelector, class Accumulate>
+    void aggregate(Iterator begin, const Iterator& end, const KeySelector& keySelector, const T& init,
+                   const Accumulate& accumulate) {
+        for (; begin != end; ++begin) {
+            RefType<Iterator> value = *begin;
+            const auto inserted = _keys.insert(keySelector(value));
+            if (inserted.second) {
+                _aggregates.push_back(init);
+            }
+            T& aggregate = _aggregates[inserted.first];
+            aggregate = accumulate(std::move(aggregate), value);
+        }
+    }
+
+public:
+    GroupAggregateTable() = default;
+
+    template<class Iterator, class KeySelector, class Accumulate>
+    GroupAggregateTable(Iterator begin, Iterator end, const KeySelector& keySelector, const T& init,
+                        const Accumulate& accumulate) {
+        aggregate(std::move(begin), end, keySelector, init, accumulate);
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    /**
+     * Every slice of [begin, end) is aggregated into its own table by a separate thread. The tables are merged afterwards, slice
+     * by slice, so the keys are in the same order as in the sequential version. Every slice starts the aggregates of its groups
+     * from `init`, which is why `init` must be the identity of `combine`.
+     */
+    template<class Execution, class Iterator, class KeySelector, class Accumulate, class Combine>
+    GroupAggregateTable(Execution execution, const Iterator& begin, const Iterator& end, const KeySelector& keySelector,
+                        const T& init, const Accumulate& accumulate, const Combine& combine) {
+        std::vector<GroupAggregateTable> partials(partitionCount(execution));
+        forEachPartition(execution, begin, end, partials.size(),
+                         [&partials, &keySelector, &init, &accumulate](Iterator first, Iterator last, const std::size_t index) {
+                             partials[index].aggregate(std::move(first), last, keySelector, init, accumulate);
+                         });
+
+        for (GroupAggregateTable& partial : partials) {
+            for (std::size_t i = 0; i < partial.size(); ++i) {
+                const auto inserted = _keys.insert(partial._keys[i]);
+                if (inserted.second) {
+                    _aggregates.push_back(std::move(partial._aggregates[i]));
+                    continue;
+                }
+                T& aggregate = _aggregates[inserted.first];
+                aggregate = combine(std::move(aggregate), std::move(partial._aggregates[i]));
+            }
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _keys.size();
+    }
+
+    LZ_NODISCARD const Key& key(const std::size_t index) const noexcept {
+        return _keys[index];
+    }
+
+    LZ_NODISCARD const T& aggregate(const std::size_t index) const noexcept {
+        return _aggregates[index];
+    }
+};
+
+template<class Key, class T>
+class GroupByAggregateIterator
+    : public IterBase<GroupByAggregateIterator<Key, T>, std::pair<const Key&, const T&>,
+                      FakePointerProxy<std::pair<const Key&, const T&>>, std::ptrdiff_t, std::random_access_iterator_tag> {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, const T&>;
+    using pointer = FakePointerProxy<reference>;
+
+    using Table = GroupAggregateTable<Key, T>;
+
+private:
+    // Built once by the view, the aggregation is done before the first group is returned
+    std::shared_ptr<const Table> _table{};
+    std::size_t _index{};
+
+public:
+    constexpr GroupByAggregateIterator() = default;
+
+    GroupByAggregateIterator(std::shared_ptr<const Table> table, const std::size_t index) :
+        _table(std::move(table)),
+        _index(index) {
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        return { _table->key(_index), _table->aggregate(_index) };
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    void increment() noexcept {
+        ++_index;
+    }
+
+    void decrement() noexcept {
+        --_index;
+    }
+
+    void plusIs(const difference_type offset) noexcept {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + offset);
+    }
+
+    LZ_NODISCARD difference_type difference(const GroupByAggregateIterator& b) const noexcept {
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(b._index);
+    }
+
+    LZ_NODISCARD bool eq(const GroupByAggregateIterator& b) const noexcept {
+        return _index == b._index;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_GROUP_BY_AGGREGATE_ITERATOR_HPP
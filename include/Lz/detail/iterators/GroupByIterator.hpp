@@ -7,8 +7,11 @@
 #include "Lz/detail/BasicIteratorView.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
+#include "Lz/detail/Parallel.hpp"
+
 #include <algorithm>
 
 namespace lz {
@@ -31,11 +34,10 @@ class GroupByIterator
     Iterator _subRangeEnd{};
     Iterator _subRangeBegin{};
     Iterator _end{};
-    mutable FunctionContainer<Comparer> _comparer{};
-#ifdef LZ_HAS_EXECUTION
-    LZ_NO_UNIQUE_ADDRESS
-    Execution _execution{};
-#endif // end LZ_HAS_EXECUTION
+    mutable FunctionStorage<Comparer> _comparer{};
+
+    template<class, class>
+    friend struct Partitioner;
 
     using IterValueType = ValueType<Iterator>;
     using Ref = RefType<Iterator>;
@@ -46,19 +48,9 @@ class GroupByIterator
         }
         Ref next = *_subRangeEnd;
         ++_subRangeEnd;
-#ifdef LZ_HAS_EXECUTION
-        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
-            _subRangeEnd = std::find_if(std::move(_subRangeEnd), _end,
-                                        [this, &next](const IterValueType& v) { return !_comparer(v, next); });
-        }
-        else {
-            _subRangeEnd = std::find_if(_execution, std::move(_subRangeEnd), _end,
-                                        [this, &next](const IterValueType& v) { return !_comparer(v, next); });
-        }
-#else
+        // Always sequential: the execution policy is applied once by the terminal operation, see Parallel.hpp
         _subRangeEnd =
             std::find_if(std::move(_subRangeEnd), _end, [this, &next](const IterValueType& v) { return !_comparer(v, next); });
-#endif
     }
 
 public:
@@ -71,20 +63,15 @@ public:
     constexpr GroupByIterator() = default;
 
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 GroupByIterator(Iterator begin, Iterator end, Comparer comparer, Execution execution) :
+    LZ_CONSTEXPR_CXX_20 GroupByIterator(Iterator begin, Iterator end, FunctionStorage<Comparer> comparer, Execution) :
 #else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
 
-    GroupByIterator(Iterator begin, Iterator end, Comparer comparer) :
+    GroupByIterator(Iterator begin, Iterator end, FunctionStorage<Comparer> comparer) :
 #endif // end LZ_HAS_EXECUTION
         _subRangeEnd(begin),
         _subRangeBegin(std::move(begin)),
         _end(std::move(end)),
-        _comparer(std::move(comparer))
-#ifdef LZ_HAS_EXECUTION
-        ,
-        _execution(execution)
-#endif // end LZ_HAS_EXECUTION
-    {
+        _comparer(std::move(comparer)) {
         if (_subRangeBegin == _end) {
             return;
         }
@@ -104,10 +91,53 @@ public:
         advance();
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const GroupByIterator& end) const {
+        return atMost(getSizeHint(_subRangeBegin, end._subRangeBegin));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const GroupByIterator& rhs) const noexcept {
         return _subRangeBegin == rhs._subRangeBegin;
     }
 };
+
+// Only splittable if the underlying range is random access, because every boundary must look at its predecessor
+#ifdef LZ_HAS_EXECUTION
+template<class Iterator, class Comparer, class Execution>
+struct Partitioner<GroupByIterator<Iterator, Comparer, Execution>, EnableIf<IsRandomAccess<Iterator>::value>> {
+    using GroupByIt = GroupByIterator<Iterator, Comparer, Execution>;
+#else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
+template<class Iterator, class Comparer>
+struct Partitioner<GroupByIterator<Iterator, Comparer>, EnableIf<IsRandomAccess<Iterator>::value>> {
+    using GroupByIt = GroupByIterator<Iterator, Comparer>;
+#endif // LZ_HAS_EXECUTION
+
+    static constexpr bool value = true;
+
+    static std::pair<GroupByIt, GroupByIt>
+    slice(const GroupByIt& begin, const GroupByIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._subRangeBegin, end._subRangeBegin, index, parts);
+        GroupByIt first = begin;
+        first._subRangeBegin = groupStart(begin, std::move(subRange.first));
+        first._subRangeEnd = first._subRangeBegin;
+        first.advance();
+        GroupByIt last = begin;
+        last._subRangeBegin = groupStart(begin, std::move(subRange.second));
+        last._subRangeEnd = last._subRangeBegin;
+        return { std::move(first), std::move(last) };
+    }
+
+private:
+    // Moves `it` forward to the start of the next group, unless it already is one. Groups may cross partition boundaries
+    static Iterator groupStart(const GroupByIt& begin, Iterator it) {
+        if (it == begin._subRangeBegin) {
+            return it;
+        }
+        while (it != begin._end && begin._comparer(*it, *(it - 1))) {
+            ++it;
+        }
+        return it;
+    }
+};
 } // namespace detail
 } // namespace lz
 #endif // LZ_GROUP_BY_ITERATOR_HPP
@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef LZ_HASH_EXCEPT_ITERATOR_HPP
+#define LZ_HASH_EXCEPT_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/Procs.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include "Lz/detail/Parallel.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+
+namespace lz {
+namespace detail {
+template<class Iterator, class IteratorToExcept>
+class HashExceptIterator : public IterBase<HashExceptIterator<Iterator, IteratorToExcept>, RefType<Iterator>,
+                                           FakePointerProxy<RefType<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    using Set = std::unordered_set<ValueType<IteratorToExcept>>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    // Built once by the view and shared by its iterators. Null if the view is created with lz::sorted, in which case both ranges
+    // are merged instead
+    std::shared_ptr<const Set> _set{};
+    IteratorToExcept _toExceptBegin{};
+    IteratorToExcept _toExceptIterator{};
+    IteratorToExcept _toExceptEnd{};
+
+    template<class, class>
+    friend struct Partitioner;
+
+    void find() {
+        if (_set) {
+            _iterator =
+                std::find_if(std::move(_iterator), _end, [this](const value_type& value) { return _set->count(value) == 0; });
+            return;
+        }
+
+        for (; _iterator != _end; ++_iterator) {
+            const value_type& value = *_iterator;
+            // Both ranges are sorted, so the exclusion range only has to move forward
+            _toExceptIterator = gallop(std::move(_toExceptIterator), _toExceptEnd,
+                                       [&value](const ValueType<IteratorToExcept>& toExcept) { return toExcept < value; });
+            if (_toExceptIterator == _toExceptEnd || value < *_toExceptIterator) {
+                return;
+            }
+        }
+    }
+
+public:
+    constexpr HashExceptIterator() = default;
+
+    HashExceptIterator(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                       std::shared_ptr<const Set> set) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _set(std::move(set)),
+        _toExceptBegin(toExceptBegin),
+        _toExceptIterator(std::move(toExceptBegin)),
+        _toExceptEnd(std::move(toExceptEnd)) {
+        find();
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        ++_iterator;
+        find();
+    }
+
+    LZ_NODISCARD SizeHint sizeHint(const HashExceptIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
+    LZ_NODISCARD bool eq(const HashExceptIterator& b) const {
+        return _iterator == b._iterator;
+    }
+};
+
+template<class Iterator, class IteratorToExcept>
+struct Partitioner<HashExceptIterator<Iterator, IteratorToExcept>> {
+    using ExceptIt = HashExceptIterator<Iterator, IteratorToExcept>;
+
+    static constexpr bool value = Partitioner<Iterator>::value;
+
+    static std::pair<ExceptIt, ExceptIt>
+    slice(const ExceptIt& begin, const ExceptIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        ExceptIt first = begin;
+        first._iterator = std::move(subRange.first);
+        first._end = subRange.second;
+        first._toExceptIterator = first._toExceptBegin;
+        first.find();
+        ExceptIt last = first;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_HASH_EXCEPT_ITERATOR_HPP
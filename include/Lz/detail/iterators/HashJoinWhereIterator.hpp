@@ -0,0 +1,244 @@
+#pragma once
+
+#ifndef LZ_HASH_JOIN_WHERE_ITERATOR_HPP
+#define LZ_HASH_JOIN_WHERE_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include "Lz/detail/Parallel.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+/**
+ * Hash table over the keys of the right hand side of a hash join. Every distinct key is stored once and points to a chain of
+ * indices into `_entries`, so duplicate keys are emitted in the order in which they appear in [begin, end). The keys are radix
+ * partitioned by their hash into independent maps, which allows every partition to be built by a separate thread.
+ */
+template<class IterB, class Key>
+class HashJoinTable {
+    struct Chain {
+        std::size_t first;
+        std::size_t last;
+    };
+
+    using Map = std::unordered_map<Key, Chain>;
+
+    std::vector<Map> _partitions{};
+    std::vector<IterB> _entries{};
+    std::vector<std::size_t> _next{};
+
+    template<class K>
+    std::size_t partitionOf(const K& key) const {
+        if (_partitions.size() == 1) {
+            return 0;
+        }
+        // Use the high bits of the hash, the maps themselves use the low bits
+        const auto hash = static_cast<std::uint64_t>(std::hash<Key>()(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(hash >> 32) % _partitions.size();
+    }
+
+    void insert(Map& partition, Key key, const std::size_t index) {
+        auto inserted = partition.emplace(std::move(key), Chain{ index, index });
+        if (!inserted.second) {
+            Chain& chain = inserted.first->second;
+            _next[chain.last] = index;
+            chain.last = index;
+        }
+    }
+
+public:
+    static constexpr std::size_t npos() noexcept {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    template<class SelectorB>
+    HashJoinTable(IterB begin, IterB end, SelectorB& selectorB) : _partitions(1) {
+        const std::size_t size = reserveSize(getSizeHint(begin, end));
+        if (size != 0) {
+            _partitions.front().reserve(size);
+            _entries.reserve(size);
+            _next.reserve(size);
+        }
+
+        for (; begin != end; ++begin) {
+            const std::size_t index = _entries.size();
+            _entries.push_back(begin);
+            _next.push_back(npos());
+            insert(_partitions.front(), selectorB(*begin), index);
+        }
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    /**
+     * Builds the table in two parallel passes. First every slice of [begin, end) writes the keys and indices of its elements
+     * into a buffer per partition, then every partition inserts its keys, slice by slice, into its own map. The keys are
+     * buffered, so that `selectorB` is called once per element. No locking is needed, because a chain only links indices of its
+     * own partition.
+     */
+    template<class Execution, class SelectorB>
+    HashJoinTable(Execution execution, IterB begin, IterB end, SelectorB& selectorB) :
+        _partitions(partitionCount(execution)),
+        _entries(static_cast<std::size_t>(end - begin)),
+        _next(_entries.size(), npos()) {
+        const std::size_t parts = _partitions.size();
+        using Scattered = std::vector<std::pair<Key, std::size_t>>;
+        std::vector<std::vector<Scattered>> scattered(parts, std::vector<Scattered>(parts));
+
+        forEachPartition(execution, begin, end, parts,
+                         [this, &begin, &scattered, &selectorB](IterB first, IterB last, const std::size_t slice) {
+                             auto index = static_cast<std::size_t>(first - begin);
+                             for (; first != last; ++first, ++index) {
+                                 _entries[index] = first;
+                                 Key key = selectorB(*first);
+                                 const std::size_t partitionIndex = partitionOf(key);
+                                 scattered[slice][partitionIndex].emplace_back(std::move(key), index);
+                             }
+                         });
+
+        forEachIndex(execution, parts, [this, &scattered](const std::size_t partitionIndex) {
+            Map& partition = _partitions[partitionIndex];
+            std::size_t size = 0;
+            for (const auto& slice : scattered) {
+                size += slice[partitionIndex].size();
+            }
+            partition.reserve(size);
+            for (auto& slice : scattered) {
+                for (auto& entry : slice[partitionIndex]) {
+                    insert(partition, std::move(entry.first), entry.second);
+                }
+            }
+        });
+    }
+#endif // LZ_HAS_EXECUTION
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _entries.empty();
+    }
+
+    // Returns the index of the first entry with key `key`, or `npos()` if there is none
+    template<class K>
+    LZ_NODISCARD std::size_t find(const K& key) const {
+        const Map& partition = _partitions[partitionOf(key)];
+        const auto pos = partition.find(key);
+        return pos == partition.end() ? npos() : pos->second.first;
+    }
+
+    LZ_NODISCARD std::size_t next(const std::size_t index) const noexcept {
+        return _next[index];
+    }
+
+    LZ_NODISCARD const IterB& operator[](const std::size_t index) const noexcept {
+        return _entries[index];
+    }
+};
+
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+class HashJoinWhereIterator
+    : public IterBase<HashJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>,
+                      IteratorFnRetT<ResultSelector, IterA, IterB>,
+                      FakePointerProxy<IteratorFnRetT<ResultSelector, IterA, IterB>>, std::ptrdiff_t, std::forward_iterator_tag> {
+public:
+    using Table = HashJoinTable<IterB, Decay<FunctionReturnType<SelectorB, RefType<IterB>>>>;
+
+private:
+    IterA _iterA{};
+    IterA _endA{};
+    // The table is built once by the view, iterators only share it
+    std::shared_ptr<const Table> _table{};
+    std::size_t _match{ Table::npos() };
+    mutable FunctionStorage<SelectorA> _selectorA{};
+    mutable FunctionStorage<ResultSelector> _resultSelector{};
+
+    template<class, class>
+    friend struct Partitioner;
+
+    void findNext() {
+        for (; _iterA != _endA; ++_iterA) {
+            _match = _table->find(_selectorA(*_iterA));
+            if (_match != Table::npos()) {
+                return;
+            }
+        }
+    }
+
+public:
+    using reference = decltype(_resultSelector(*_iterA, *(*_table)[0]));
+    using value_type = Decay<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    HashJoinWhereIterator(IterA iterA, IterA endA, std::shared_ptr<const Table> table, FunctionStorage<SelectorA> a,
+                          FunctionStorage<ResultSelector> resultSelector) :
+        _iterA(std::move(iterA)),
+        _endA(std::move(endA)),
+        _table(std::move(table)),
+        _selectorA(std::move(a)),
+        _resultSelector(std::move(resultSelector)) {
+        if (_table->empty()) {
+            _iterA = _endA;
+            return;
+        }
+        findNext();
+    }
+
+    constexpr HashJoinWhereIterator() = default;
+
+    LZ_NODISCARD reference dereference() const {
+        return _resultSelector(*_iterA, *(*_table)[_match]);
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        _match = _table->next(_match);
+        if (_match != Table::npos()) {
+            return;
+        }
+        ++_iterA;
+        findNext();
+    }
+
+    LZ_NODISCARD bool eq(const HashJoinWhereIterator& b) const noexcept {
+        return _iterA == b._iterA && _match == b._match;
+    }
+};
+
+// Every sub range of A probes the same table
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+struct Partitioner<HashJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+    using JoinIt = HashJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+
+    static constexpr bool value = Partitioner<IterA>::value;
+
+    static std::pair<JoinIt, JoinIt>
+    slice(const JoinIt& begin, const JoinIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<IterA>::slice(begin._iterA, end._iterA, index, parts);
+        JoinIt first = begin;
+        first._iterA = std::move(subRange.first);
+        first._endA = subRange.second;
+        first._match = JoinIt::Table::npos();
+        first.findNext();
+        JoinIt last = first;
+        last._iterA = std::move(subRange.second);
+        last._match = JoinIt::Table::npos();
+        return { std::move(first), std::move(last) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_HASH_JOIN_WHERE_ITERATOR_HPP
@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 namespace lz {
 namespace detail {
@@ -46,6 +47,10 @@ public:
         }
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const InclusiveScanIterator& end) const {
+        return getSizeHint(_iterator, end._iterator);
+    }
+
     LZ_NODISCARD constexpr bool eq(const InclusiveScanIterator& b) const {
         return _iterator == b._iterator;
     }
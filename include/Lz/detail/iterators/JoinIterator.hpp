@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 #if defined(LZ_STANDALONE)
@@ -178,6 +179,14 @@ public:
         return (_iterator - b._iterator) * 2 - 1;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const JoinIterator& end) const {
+        const bool isIteratorTurn = _isIteratorTurn;
+        // Every element but the last one is followed by a delimiter
+        return transformSize(getSizeHint(_iterator, end._iterator), [isIteratorTurn](const std::size_t n) -> std::size_t {
+            return n == 0 ? 0 : isIteratorTurn ? n * 2 - 1 : n * 2;
+        });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const JoinIterator& b) const noexcept {
         LZ_ASSERT(_delimiter == b._delimiter, "incompatible iterator types: found different delimiters");
         return _iterator == b._iterator;
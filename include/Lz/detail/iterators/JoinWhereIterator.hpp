@@ -8,6 +8,10 @@
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
 
+#include "Lz/detail/Parallel.hpp"
+
+#include <algorithm>
+
 namespace lz {
 namespace detail {
 #ifdef LZ_HAS_EXECUTION
@@ -36,45 +40,15 @@ private:
     IterB _iterB{};
     IterB _beginB{};
     IterB _endB{};
-#ifdef LZ_HAS_EXECUTION
-    LZ_NO_UNIQUE_ADDRESS
-    Execution _exec{};
-#endif // LZ_HAS_EXECUTION
-    mutable FunctionContainer<SelectorA> _selectorA{};
-    mutable FunctionContainer<SelectorB> _selectorB{};
-    mutable FunctionContainer<ResultSelector> _resultSelector{};
+    mutable FunctionStorage<SelectorA> _selectorA{};
+    mutable FunctionStorage<SelectorB> _selectorB{};
+    mutable FunctionStorage<ResultSelector> _resultSelector{};
+
+    template<class, class>
+    friend struct Partitioner;
 
     void findNext() {
-#ifdef LZ_HAS_EXECUTION
-        if constexpr (isCompatibleForExecution<Execution, IterA>()) {
-            _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
-                auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
-                                     [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
-                }
-                _iterB = _beginB;
-                return false;
-            });
-        }
-        else {
-            std::mutex mutex;
-            std::lock_guard guard(mutex);
-            _iterA = std::find_if(_exec, _iterA, _endA, [this, &mutex](const ValueType<IterA>& a) {
-                auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
-                                     [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
-                }
-                _iterB = _beginB;
-                return false;
-            });
-        }
-#else
+        // Always sequential: the execution policy is applied once by the terminal operation, see Parallel.hpp
         _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
             auto&& toFind = _selectorA(a);
             _iterB = std::lower_bound(std::move(_iterB), _endB, toFind,
@@ -85,7 +59,6 @@ private:
             _iterB = _beginB;
             return false;
         });
-#endif // LZ_HAS_EXECUTION
     }
 
 public:
@@ -96,11 +69,11 @@ public:
     using pointer = FakePointerProxy<reference>;
 
 #ifdef LZ_HAS_EXECUTION
-    LZ_CONSTEXPR_CXX_20 JoinWhereIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b,
-                                          ResultSelector resultSelector, Execution execution)
+    LZ_CONSTEXPR_CXX_20 JoinWhereIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, FunctionStorage<SelectorA> a,
+                                          FunctionStorage<SelectorB> b, FunctionStorage<ResultSelector> resultSelector, Execution)
 #else
-    LZ_CONSTEXPR_CXX_20
-    JoinWhereIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector)
+    LZ_CONSTEXPR_CXX_20 JoinWhereIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, FunctionStorage<SelectorA> a,
+                                          FunctionStorage<SelectorB> b, FunctionStorage<ResultSelector> resultSelector)
 #endif // LZ_HAS_EXECUTION
         :
         _iterA(std::move(iterA)),
@@ -108,13 +81,11 @@ public:
         _iterB(iterB),
         _beginB(iterB == endB ? endB : std::move(iterB)),
         _endB(std::move(endB)),
-#ifdef LZ_HAS_EXECUTION
-        _exec(execution),
-#endif // LZ_HAS_EXECUTION
         _selectorA(std::move(a)),
         _selectorB(std::move(b)),
         _resultSelector(std::move(resultSelector)) {
-        if (_iterA == _endA || _iterB == _endB) {
+        if (_iterB == _endB) {
+            _iterA = _endA;
             return;
         }
         findNext();
@@ -140,6 +111,32 @@ public:
     }
 };
 
+// Every sub range of A is joined with the whole of B
+#ifdef LZ_HAS_EXECUTION
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, class Execution>
+struct Partitioner<JoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, Execution>> {
+    using JoinIt = JoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector, Execution>;
+#else
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+struct Partitioner<JoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+    using JoinIt = JoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+#endif // LZ_HAS_EXECUTION
+
+    static constexpr bool value = Partitioner<IterA>::value;
+
+    static std::pair<JoinIt, JoinIt>
+    slice(const JoinIt& begin, const JoinIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<IterA>::slice(begin._iterA, end._iterA, index, parts);
+        JoinIt first = begin;
+        first._iterA = std::move(subRange.first);
+        first._endA = subRange.second;
+        first._iterB = first._beginB;
+        first.findNext();
+        JoinIt last = first;
+        last._iterA = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
 } // namespace detail
 } // namespace lz
 #endif // LZ_JOIN_WHERE_ITERATOR_HPP
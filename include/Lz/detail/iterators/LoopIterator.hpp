@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -72,6 +73,11 @@ public:
         return (std::numeric_limits<difference_type>::max)();
     }
 
+    // Loops forever, so its size is unknown, even if it is random access
+    LZ_NODISCARD constexpr SizeHint sizeHint(const LoopIterator&) const noexcept {
+        return unknownSize();
+    }
+
     LZ_NODISCARD constexpr bool eq(const LoopIterator&) const noexcept {
         return false;
     }
@@ -4,9 +4,13 @@
 #define LZ_MAP_ITERATOR_HPP
 
 #include "Lz/IterBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include "Lz/detail/Parallel.hpp"
 
 namespace lz {
 namespace detail {
@@ -14,10 +18,13 @@ template<class Iterator, class Function>
 class MapIterator : public IterBase<MapIterator<Iterator, Function>, IteratorFnRetT<Function, Iterator>,
                                     FakePointerProxy<IteratorFnRetT<Function, Iterator>>, DiffType<Iterator>, IterCat<Iterator>> {
     Iterator _iterator{};
-    FunctionContainer<Function> _function{};
+    FunctionStorage<Function> _function{};
 
     using IterTraits = std::iterator_traits<Iterator>;
 
+    template<class, class>
+    friend struct Partitioner;
+
 public:
     using reference = decltype(_function(*_iterator));
     using value_type = Decay<reference>;
@@ -25,13 +32,25 @@ public:
     using difference_type = typename IterTraits::difference_type;
     using pointer = FakePointerProxy<reference>;
 
-    LZ_CONSTEXPR_CXX_20 MapIterator(Iterator iterator, Function function) :
+    // A map only drives its underlying sequence if that one can be driven more efficiently itself, see `HasPush`
+    using PushIteration = HasPush<Iterator>;
+
+    LZ_CONSTEXPR_CXX_20 MapIterator(Iterator iterator, FunctionStorage<Function> function) :
         _iterator(std::move(iterator)),
         _function(std::move(function)) {
     }
 
     constexpr MapIterator() = default;
 
+    // Used to fuse adjacent maps, see Fusion.hpp
+    LZ_NODISCARD constexpr const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD const Function& function() const noexcept {
+        return _function.function();
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference dereference() const {
         return _function(*_iterator);
     }
@@ -56,10 +75,39 @@ public:
         return _iterator - b._iterator;
     }
 
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool push(const MapIterator& end, Sink& sink) const {
+        auto& function = _function;
+        auto mapSink = [&function, &sink](RefType<Iterator> value) -> bool {
+            return sink(function(std::forward<RefType<Iterator>>(value)));
+        };
+        return pushEach(_iterator, end._iterator, mapSink);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const MapIterator& end) const {
+        return getSizeHint(_iterator, end._iterator);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const MapIterator& b) const noexcept {
         return _iterator == b._iterator;
     }
 };
+
+template<class Iterator, class Function>
+struct Partitioner<MapIterator<Iterator, Function>, EnableIf<!IsRandomAccess<Iterator>::value>> {
+    using MapIt = MapIterator<Iterator, Function>;
+
+    static constexpr bool value = Partitioner<Iterator>::value;
+
+    static std::pair<MapIt, MapIt> slice(const MapIt& begin, const MapIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        MapIt first = begin;
+        first._iterator = std::move(subRange.first);
+        MapIt last = begin;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
 } // namespace detail
 } // namespace lz
 
@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef LZ_MERGE_JOIN_WHERE_ITERATOR_HPP
+#define LZ_MERGE_JOIN_WHERE_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/Procs.hpp"
+
+#include "Lz/detail/Parallel.hpp"
+
+namespace lz {
+namespace detail {
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+class MergeJoinWhereIterator
+    : public IterBase<MergeJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>,
+                      IteratorFnRetT<ResultSelector, IterA, IterB>,
+                      FakePointerProxy<IteratorFnRetT<ResultSelector, IterA, IterB>>, std::ptrdiff_t, std::forward_iterator_tag> {
+    IterA _iterA{};
+    IterA _endA{};
+    // [_groupB, ...) is the run of elements in B with the key of *_iterA, _iterB is the current element in that run
+    IterB _groupB{};
+    IterB _iterB{};
+    IterB _endB{};
+    mutable FunctionStorage<SelectorA> _selectorA{};
+    mutable FunctionStorage<SelectorB> _selectorB{};
+    mutable FunctionStorage<ResultSelector> _resultSelector{};
+
+    template<class, class>
+    friend struct Partitioner;
+
+    LZ_CONSTEXPR_CXX_20 void findNext() {
+        while (_iterA != _endA && _groupB != _endB) {
+            auto&& keyA = _selectorA(*_iterA);
+            auto&& keyB = _selectorB(*_groupB);
+            if (keyA < keyB) {
+                _iterA = gallop(std::move(_iterA), _endA, [this, &keyB](RefType<IterA> a) { return _selectorA(a) < keyB; });
+            }
+            else if (keyB < keyA) {
+                _groupB = gallop(std::move(_groupB), _endB, [this, &keyA](RefType<IterB> b) { return _selectorB(b) < keyA; });
+            }
+            else {
+                _iterB = _groupB;
+                return;
+            }
+        }
+        _iterA = _endA;
+        _groupB = _iterB = _endB;
+    }
+
+public:
+    using reference = decltype(_resultSelector(*_iterA, *_iterB));
+    using value_type = Decay<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    LZ_CONSTEXPR_CXX_20
+    MergeJoinWhereIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, FunctionStorage<SelectorA> a,
+                           FunctionStorage<SelectorB> b, FunctionStorage<ResultSelector> resultSelector) :
+        _iterA(std::move(iterA)),
+        _endA(std::move(endA)),
+        _groupB(iterB),
+        _iterB(std::move(iterB)),
+        _endB(std::move(endB)),
+        _selectorA(std::move(a)),
+        _selectorB(std::move(b)),
+        _resultSelector(std::move(resultSelector)) {
+        findNext();
+    }
+
+    constexpr MergeJoinWhereIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference dereference() const {
+        return _resultSelector(*_iterA, *_iterB);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 void increment() {
+        auto&& key = _selectorB(*_groupB);
+        ++_iterB;
+        if (_iterB != _endB && !(key < _selectorB(*_iterB))) {
+            return;
+        }
+
+        ++_iterA;
+        if (_iterA != _endA && !(key < _selectorA(*_iterA))) {
+            // Duplicate key in A, emit the same run of B again
+            _iterB = _groupB;
+            return;
+        }
+        _groupB = _iterB;
+        findNext();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const MergeJoinWhereIterator& b) const noexcept {
+        return _iterA == b._iterA && _iterB == b._iterB;
+    }
+};
+
+// Every sub range of A is merged with B, starting from the run in B that matched the first element of the whole join
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+struct Partitioner<MergeJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+    using JoinIt = MergeJoinWhereIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+
+    static constexpr bool value = Partitioner<IterA>::value;
+
+    static std::pair<JoinIt, JoinIt>
+    slice(const JoinIt& begin, const JoinIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<IterA>::slice(begin._iterA, end._iterA, index, parts);
+        JoinIt first = begin;
+        first._iterA = std::move(subRange.first);
+        first._endA = subRange.second;
+        first._iterB = first._groupB;
+        first.findNext();
+        // Once A is exhausted, findNext also moves B to its end
+        JoinIt last = first;
+        last._iterA = std::move(subRange.second);
+        last._groupB = last._iterB = last._endB;
+        return { std::move(first), std::move(last) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_MERGE_JOIN_WHERE_ITERATOR_HPP
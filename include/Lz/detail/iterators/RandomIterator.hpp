@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 namespace lz {
 namespace detail {
@@ -80,6 +81,10 @@ public:
         return _current - b._current;
     }
 
+    LZ_NODISCARD constexpr SizeHint sizeHint(const RandomIterator& end) const {
+        return _isWhileTrueLoop ? unknownSize() : exactSize(static_cast<std::size_t>(end._current - _current));
+    }
+
     LZ_NODISCARD bool eq(const RandomIterator& b) const noexcept {
         LZ_ASSERT(_isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return _current == b._current;
@@ -5,6 +5,7 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 #include <limits>
 
@@ -62,6 +63,10 @@ public:
         return static_cast<difference_type>(_iterator - b._iterator);
     }
 
+    LZ_NODISCARD constexpr SizeHint sizeHint(const RepeatIterator& end) const {
+        return _amount == (std::numeric_limits<std::size_t>::max)() ? unknownSize() : exactSize(end._iterator - _iterator);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 bool eq(const RepeatIterator& b) const noexcept {
         LZ_ASSERT(_amount == b._amount, "incompatible iterator types: amount of times to repeat not the same");
         return _iterator == b._iterator;
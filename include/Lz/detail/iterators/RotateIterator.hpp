@@ -5,6 +5,7 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/Traits.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 #include <iterator>
 
@@ -62,6 +63,13 @@ public:
         --_iterator;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const RotateIterator& end) const {
+        if (_fullRotation) {
+            return getSizeHint(_iterator, end._iterator);
+        }
+        return getSizeHint(_iterator, _end) + getSizeHint(_begin, end._iterator);
+    }
+
     LZ_NODISCARD constexpr bool eq(const RotateIterator& b) const {
         return _iterator == b._iterator && (_fullRotation && b._fullRotation);
     }
@@ -0,0 +1,215 @@
+#pragma once
+
+#ifndef LZ_SEMI_JOIN_ITERATOR_HPP
+#define LZ_SEMI_JOIN_ITERATOR_HPP
+
+#include "Lz/IterBase.hpp"
+#include "Lz/detail/BloomFilter.hpp"
+#include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
+
+#include "Lz/detail/Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_set>
+
+namespace lz {
+namespace detail {
+struct SemiJoinStats {
+    // The amount of keys that were looked up
+    std::size_t probes;
+    // The amount of probes that were rejected by the bloom filter, without touching the hash set
+    std::size_t filterRejects;
+    // The amount of probes that passed the bloom filter, but were not in the hash set
+    std::size_t falsePositives;
+
+    LZ_NODISCARD std::size_t matches() const noexcept {
+        return probes - filterRejects - falsePositives;
+    }
+
+    // The fraction of probes that was answered by the bloom filter alone
+    LZ_NODISCARD double filterRejectRate() const noexcept {
+        return probes == 0 ? 0 : static_cast<double>(filterRejects) / static_cast<double>(probes);
+    }
+
+    // The fraction of keys that are not in B, but did pass the bloom filter
+    LZ_NODISCARD double falsePositiveRate() const noexcept {
+        const std::size_t misses = filterRejects + falsePositives;
+        return misses == 0 ? 0 : static_cast<double>(falsePositives) / static_cast<double>(misses);
+    }
+};
+
+// The statistics of a table, which are only counted if they are asked for, because every probe updates them
+template<bool CollectStats>
+class SemiJoinCounters {
+    mutable std::atomic<std::size_t> _probes{ 0 };
+    mutable std::atomic<std::size_t> _filterRejects{ 0 };
+    mutable std::atomic<std::size_t> _falsePositives{ 0 };
+
+public:
+    void probe() const noexcept {
+        _probes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void filterReject() const noexcept {
+        _filterRejects.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void falsePositive() const noexcept {
+        _falsePositives.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    LZ_NODISCARD SemiJoinStats stats() const noexcept {
+        return { _probes.load(std::memory_order_relaxed), _filterRejects.load(std::memory_order_relaxed),
+                 _falsePositives.load(std::memory_order_relaxed) };
+    }
+};
+
+template<>
+class SemiJoinCounters<false> {
+public:
+    void probe() const noexcept {
+    }
+
+    void filterReject() const noexcept {
+    }
+
+    void falsePositive() const noexcept {
+    }
+};
+
+/**
+ * The keys of the right hand side of a semi or anti join: a blocked bloom filter in front of a hash set. Most probes of keys that
+ * are not in the set are rejected by the filter, which is small enough to stay in cache, instead of by the much larger set.
+ */
+template<class Key, bool CollectStats>
+class SemiJoinTable {
+    BlockedBloomFilter _filter{};
+    std::unordered_set<Key> _keys{};
+    SemiJoinCounters<CollectStats> _counters{};
+
+public:
+    template<class IterB, class SelectorB>
+    SemiJoinTable(IterB begin, IterB end, SelectorB& selectorB, const double falsePositiveRate) {
+        const std::size_t size = reserveSize(getSizeHint(begin, end));
+        if (size != 0) {
+            _keys.reserve(size);
+        }
+        for (; begin != end; ++begin) {
+            _keys.insert(selectorB(*begin));
+        }
+
+        _filter = BlockedBloomFilter(_keys.size(), falsePositiveRate);
+        for (const Key& key : _keys) {
+            _filter.insert(std::hash<Key>()(key));
+        }
+    }
+
+    template<class K>
+    LZ_NODISCARD bool contains(const K& key) const {
+        _counters.probe();
+        if (!_filter.mayContain(std::hash<Key>()(key))) {
+            _counters.filterReject();
+            return false;
+        }
+        if (_keys.count(key) == 0) {
+            _counters.falsePositive();
+            return false;
+        }
+        return true;
+    }
+
+    LZ_NODISCARD SemiJoinStats stats() const noexcept {
+        return _counters.stats();
+    }
+};
+
+template<class Iterator, class IterB, class SelectorA, class SelectorB, bool Anti, bool CollectStats>
+class SemiJoinIterator
+    : public IterBase<SemiJoinIterator<Iterator, IterB, SelectorA, SelectorB, Anti, CollectStats>, RefType<Iterator>,
+                      FakePointerProxy<RefType<Iterator>>, DiffType<Iterator>, std::forward_iterator_tag> {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    using Table = SemiJoinTable<Decay<FunctionReturnType<SelectorB, RefType<IterB>>>, CollectStats>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    // Built once by the view and shared by its iterators
+    std::shared_ptr<const Table> _table{};
+    mutable FunctionStorage<SelectorA> _selectorA{};
+
+    template<class, class>
+    friend struct Partitioner;
+
+    void find() {
+        // A semi join keeps the elements whose key is in B, an anti join the elements whose key is not
+        _iterator = std::find_if(std::move(_iterator), _end,
+                                 [this](const value_type& value) { return _table->contains(_selectorA(value)) != Anti; });
+    }
+
+public:
+    constexpr SemiJoinIterator() = default;
+
+    SemiJoinIterator(Iterator begin, Iterator end, std::shared_ptr<const Table> table, FunctionStorage<SelectorA> selectorA) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _table(std::move(table)),
+        _selectorA(std::move(selectorA)) {
+        find();
+    }
+
+    LZ_NODISCARD reference dereference() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer arrow() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        ++_iterator;
+        find();
+    }
+
+    LZ_NODISCARD SizeHint sizeHint(const SemiJoinIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
+    LZ_NODISCARD bool eq(const SemiJoinIterator& b) const {
+        return _iterator == b._iterator;
+    }
+};
+
+template<class Iterator, class IterB, class SelectorA, class SelectorB, bool Anti, bool CollectStats>
+struct Partitioner<SemiJoinIterator<Iterator, IterB, SelectorA, SelectorB, Anti, CollectStats>> {
+    using JoinIt = SemiJoinIterator<Iterator, IterB, SelectorA, SelectorB, Anti, CollectStats>;
+
+    static constexpr bool value = Partitioner<Iterator>::value;
+
+    static std::pair<JoinIt, JoinIt>
+    slice(const JoinIt& begin, const JoinIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        JoinIt first = begin;
+        first._iterator = std::move(subRange.first);
+        first._end = subRange.second;
+        first.find();
+        JoinIt last = first;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_SEMI_JOIN_ITERATOR_HPP
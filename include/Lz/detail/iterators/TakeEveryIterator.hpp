@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -54,6 +55,13 @@ public:
         }
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const TakeEveryIterator& end) const {
+        const auto offset = static_cast<std::size_t>(_offset);
+        return transformSize(getSizeHint(_iterator, end._iterator), [offset](const std::size_t n) {
+            return offset == 0 ? n : (n + offset - 1) / offset;
+        });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const TakeEveryIterator& a, const TakeEveryIterator& b) noexcept {
         return !(a != b); // NOLINT
     }
@@ -215,6 +223,13 @@ public:
         return (rawDifference + (_offset - 1)) / _offset;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const TakeEveryIterator& end) const {
+        const auto offset = static_cast<std::size_t>(_offset);
+        return transformSize(getSizeHint(_iterator, end._iterator), [offset](const std::size_t n) {
+            return offset == 0 ? n : (n + offset - 1) / offset;
+        });
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const TakeEveryIterator& b) const noexcept {
         LZ_ASSERT(_offset == b._offset, "incompatible iterator types: different offsets");
         return _iterator == b._iterator;
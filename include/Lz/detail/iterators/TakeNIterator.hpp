@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Lz/IterBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
 #include <iterator>
 
@@ -22,6 +24,10 @@ public:
     using reference = typename IterTraits::reference;
     using pointer = FakePointerProxy<reference>;
 
+    // The first elements of a contiguous sequence are contiguous as well, see `HasContiguousData`
+    using ContiguousElement =
+        Conditional<IsContiguousIterator<Iterator>::value, typename std::remove_reference<reference>::type, void>;
+
 private:
     Iterator _iterator{};
     difference_type _n{};
@@ -32,6 +38,11 @@ public:
     constexpr TakeNIterator(Iterator iterator, const difference_type n) noexcept : _iterator(iterator), _n(n) {
     }
 
+    // Used to fuse adjacent takes, see Fusion.hpp
+    LZ_NODISCARD constexpr const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference dereference() const {
         return *_iterator;
     }
@@ -59,6 +70,18 @@ public:
         return _n - b._n;
     }
 
+    LZ_NODISCARD ContiguousElement* contiguousData(const TakeNIterator& end, std::size_t& size) const {
+        if (_n == end._n) {
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(end._n - _n);
+        return std::addressof(*_iterator);
+    }
+
+    LZ_NODISCARD constexpr SizeHint sizeHint(const TakeNIterator& end) const {
+        return exactSize(static_cast<std::size_t>(end._n - _n));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const TakeNIterator& b) const noexcept {
         return _n == b._n;
     }
@@ -7,6 +7,7 @@
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -17,7 +18,7 @@ class TakeWhileIterator : public IterBase<TakeWhileIterator<Iterator, UnaryPredi
 
     Iterator _iterator{};
     Iterator _end{};
-    FunctionContainer<UnaryPredicate> _unaryPredicate{};
+    FunctionStorage<UnaryPredicate> _unaryPredicate{};
 
     using IterTraits = std::iterator_traits<Iterator>;
 
@@ -36,7 +37,7 @@ public:
 
     constexpr TakeWhileIterator() = default;
 
-    LZ_CONSTEXPR_CXX_14 TakeWhileIterator(Iterator iterator, Iterator end, UnaryPredicate unaryPredicate) :
+    LZ_CONSTEXPR_CXX_14 TakeWhileIterator(Iterator iterator, Iterator end, FunctionStorage<UnaryPredicate> unaryPredicate) :
         _iterator(std::move(iterator)),
         _end(std::move(end)),
         _unaryPredicate(std::move(unaryPredicate)) {
@@ -56,6 +57,10 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const TakeWhileIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
     LZ_CONSTEXPR_CXX_20 bool eq(const TakeWhileIterator& b) const noexcept {
         return _iterator == b._iterator;
     }
@@ -7,10 +7,9 @@
 #include "Lz/detail/CompilerChecks.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/FunctionContainer.hpp"
+#include "Lz/detail/SizeHint.hpp"
 
-#ifdef LZ_HAS_EXECUTION
-#include "Lz/detail/Procs.hpp"
-#endif
+#include "Lz/detail/Parallel.hpp"
 
 #include <algorithm>
 
@@ -29,11 +28,10 @@ class UniqueIterator : public IterBase<UniqueIterator<Iterator, Compare>, RefTyp
 
     Iterator _iterator{};
     Iterator _end{};
-    mutable FunctionContainer<Compare> _compare{};
-#ifdef LZ_HAS_EXECUTION
-    LZ_NO_UNIQUE_ADDRESS
-    Execution _execution;
-#endif // LZ_HAS_EXECUTION
+    mutable FunctionStorage<Compare> _compare{};
+
+    template<class, class>
+    friend struct Partitioner;
 
 public:
     using iterator_category = std::forward_iterator_tag;
@@ -43,19 +41,14 @@ public:
     using pointer = FakePointerProxy<reference>;
 
 #ifdef LZ_HAS_EXECUTION
-    constexpr UniqueIterator(Iterator begin, Iterator end, Compare compare, Execution execution)
+    constexpr UniqueIterator(Iterator begin, Iterator end, FunctionStorage<Compare> compare, Execution)
 #else  // ^^^ lz has execution vvv ! lz has execution
-    constexpr UniqueIterator(Iterator begin, Iterator end, Compare compare)
+    constexpr UniqueIterator(Iterator begin, Iterator end, FunctionStorage<Compare> compare)
 #endif // LZ_HAS_EXECUTION
         :
         _iterator(std::move(begin)),
         _end(std::move(end)),
-        _compare(std::move(compare))
-#ifdef LZ_HAS_EXECUTION
-        ,
-        _execution(execution)
-#endif // LZ_HAS_EXECUTION
-    {
+        _compare(std::move(compare)) {
     }
 
     constexpr UniqueIterator() = default;
@@ -69,26 +62,57 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 void increment() {
-#ifdef LZ_HAS_EXECUTION
-        if constexpr (detail::isCompatibleForExecution<Execution, Iterator>()) {
-            _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
-        }
-        else {
-            _iterator = std::adjacent_find(_execution, std::move(_iterator), _end, _compare);
-        }
-#else  // ^^^ lz has execution vvv ! lz has execution
+        // Always sequential: the execution policy is applied once by the terminal operation, see Parallel.hpp
         _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
-#endif // LZ_HAS_EXECUTION
 
         if (_iterator != _end) {
             ++_iterator;
         }
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const UniqueIterator& end) const {
+        return atMost(getSizeHint(_iterator, end._iterator));
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const UniqueIterator& b) const noexcept {
         return _iterator == b._iterator;
     }
 };
+
+// Only splittable if the underlying range is random access, because every boundary must look at its predecessor
+#ifdef LZ_HAS_EXECUTION
+template<class Execution, class Iterator, class Compare>
+struct Partitioner<UniqueIterator<Execution, Iterator, Compare>, EnableIf<IsRandomAccess<Iterator>::value>> {
+    using UniqueIt = UniqueIterator<Execution, Iterator, Compare>;
+#else  // ^^^ lz has execution vvv ! lz has execution
+template<class Iterator, class Compare>
+struct Partitioner<UniqueIterator<Iterator, Compare>, EnableIf<IsRandomAccess<Iterator>::value>> {
+    using UniqueIt = UniqueIterator<Iterator, Compare>;
+#endif // LZ_HAS_EXECUTION
+
+    static constexpr bool value = true;
+
+    static std::pair<UniqueIt, UniqueIt>
+    slice(const UniqueIt& begin, const UniqueIt& end, const std::size_t index, const std::size_t parts) {
+        auto subRange = Partitioner<Iterator>::slice(begin._iterator, end._iterator, index, parts);
+        UniqueIt first = begin;
+        first._iterator = nextUnique(begin, subRange.first, subRange.second);
+        first._end = subRange.second;
+        UniqueIt last = first;
+        last._iterator = std::move(subRange.second);
+        return { std::move(first), std::move(last) };
+    }
+
+private:
+    // Returns the first element in [first, last) that is not equal to its predecessor
+    static Iterator nextUnique(const UniqueIt& begin, const Iterator& first, const Iterator& last) {
+        if (first == begin._iterator || first == last) {
+            return first;
+        }
+        auto it = std::adjacent_find(first - 1, last, begin._compare);
+        return it == last ? it : it + 1;
+    }
+};
 } // namespace detail
 } // namespace lz
 
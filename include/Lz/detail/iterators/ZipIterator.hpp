@@ -5,6 +5,7 @@
 
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 #include <algorithm>
@@ -60,6 +61,12 @@ private:
         return std::find(std::begin(expander), end, true) != end;
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipIterator& end, IndexSequence<I...>) const {
+        const SizeHint sizes[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        return std::accumulate(std::next(std::begin(sizes)), std::end(sizes), sizes[0], minSize);
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 explicit ZipIterator(std::tuple<Iterators...> iterators) : _iterators(std::move(iterators)) {
     }
@@ -90,6 +97,10 @@ public:
         return minus(other, MakeIndexSequenceForThis());
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipIterator& end) const {
+        return sizeHint(end, MakeIndexSequenceForThis());
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ZipIterator& b) const {
         return eq(b, MakeIndexSequenceForThis());
     }
@@ -6,6 +6,7 @@
 #include "Lz/IterBase.hpp"
 #include "Lz/detail/FakePointerProxy.hpp"
 #include "Lz/detail/Optional.hpp"
+#include "Lz/detail/SizeHint.hpp"
 #include "Lz/detail/Traits.hpp"
 
 namespace lz {
@@ -68,6 +69,12 @@ private:
         return std::find(std::begin(expander), end, false) == end;
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipLongestIterator& end, IndexSequence<I...>) const {
+        const SizeHint sizes[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        return std::accumulate(std::begin(sizes), std::end(sizes), exactSize(0), maxSize);
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 explicit ZipLongestIterator(std::tuple<Iterators...> iterators, std::tuple<Iterators...> end) :
         _iterators(std::move(iterators)),
@@ -88,6 +95,10 @@ public:
         increment(MakeIndexSequenceForThis());
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipLongestIterator& end) const {
+        return sizeHint(end, MakeIndexSequenceForThis());
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ZipLongestIterator& b) const {
         return eq(b, MakeIndexSequenceForThis());
     }
@@ -213,6 +224,12 @@ private:
         return *std::min_element(std::begin(allSizes), std::end(allSizes)) < 0;
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipLongestIterator& end, IndexSequence<I...>) const {
+        const SizeHint sizes[] = { getSizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        return std::accumulate(std::begin(sizes), std::end(sizes), exactSize(0), maxSize);
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 explicit ZipLongestIterator(std::tuple<Iterators...> begin, std::tuple<Iterators...> iterators,
                                                     std::tuple<Iterators...> end) :
@@ -256,6 +273,10 @@ public:
         return *(*this + offset);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const ZipLongestIterator& end) const {
+        return sizeHint(end, MakeIndexSequenceForThis());
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool eq(const ZipLongestIterator& b) const {
         return eq(b, MakeIndexSequenceForThis());
     }
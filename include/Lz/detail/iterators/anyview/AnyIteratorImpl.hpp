@@ -4,179 +4,201 @@
 #define LZ_ANY_VIEW_ITERATOR_IMPL_HPP
 
 #include "IteratorBase.hpp"
+#include "Lz/detail/BatchedIteration.hpp"
+
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace lz {
 namespace detail {
-template<class Iter, class T, class Reference, class IterCat, class DiffType>
-class AnyIteratorImpl;
-
-template<class Iter, class T, class Reference, class DiffType>
-class AnyIteratorImpl<Iter, T, Reference, std::forward_iterator_tag, DiffType> final
-    : public IteratorBase<Reference, std::forward_iterator_tag, DiffType> {
-    Iter _iter{};
+template<class Iter>
+struct FitsAnyIteratorStorage
+    : std::integral_constant<bool, sizeof(Iter) <= AnyIteratorStorage::Size && alignof(Iter) <= AnyIteratorStorage::Alignment &&
+                                       std::is_nothrow_move_constructible<Iter>::value> {};
 
-    static_assert(std::is_same<Reference, decltype(*_iter)>::value,
-                  "The iterator operator* returns a different type than template parameter `Reference`. Try adding/removing "
-                  "`&` to `Reference`");
-
-    using AnyIteratorBase = IteratorBase<Reference, std::forward_iterator_tag, DiffType>;
+// Access to an iterator that is stored in the inline storage itself
+template<class Iter, bool = FitsAnyIteratorStorage<Iter>::value>
+struct AnyIteratorStorageAccess {
+    static Iter& get(AnyIteratorStorage& storage) noexcept {
+        return *reinterpret_cast<Iter*>(storage.buffer);
+    }
 
-public:
-    using value_type = T;
-    using reference = Reference;
-    using pointer = FakePointerProxy<reference>;
-    using difference_type = DiffType;
-    using iterator_category = std::forward_iterator_tag;
+    static const Iter& get(const AnyIteratorStorage& storage) noexcept {
+        return *reinterpret_cast<const Iter*>(storage.buffer);
+    }
 
-    AnyIteratorImpl() = default;
+    template<class I>
+    static void construct(AnyIteratorStorage& storage, I&& iter) {
+        ::new (static_cast<void*>(storage.buffer)) Iter(std::forward<I>(iter));
+    }
 
-    AnyIteratorImpl(Iter iter) : _iter(std::move(iter)) {
+    static void move(AnyIteratorStorage& from, AnyIteratorStorage& to) noexcept {
+        construct(to, std::move(get(from)));
+        destroy(from);
     }
 
-    ~AnyIteratorImpl() override = default;
+    static void destroy(AnyIteratorStorage& storage) noexcept {
+        get(storage).~Iter();
+    }
+};
 
-    reference dereference() override {
-        return *_iter;
+// Access to an iterator on the heap, the inline storage only holds a pointer to it
+template<class Iter>
+struct AnyIteratorStorageAccess<Iter, false> {
+    static Iter*& pointer(AnyIteratorStorage& storage) noexcept {
+        return *reinterpret_cast<Iter**>(storage.buffer);
     }
 
-    reference dereference() const override {
-        return *_iter;
+    static Iter& get(AnyIteratorStorage& storage) noexcept {
+        return *pointer(storage);
     }
 
-    pointer arrow() override {
-        return pointer{ dereference() };
+    static const Iter& get(const AnyIteratorStorage& storage) noexcept {
+        return **reinterpret_cast<Iter* const*>(storage.buffer);
     }
 
-    void increment() override {
-        ++_iter;
+    template<class I>
+    static void construct(AnyIteratorStorage& storage, I&& iter) {
+        ::new (static_cast<void*>(storage.buffer)) Iter*(new Iter(std::forward<I>(iter)));
     }
 
-    bool eq(const AnyIteratorBase& other) const override {
-        return _iter == static_cast<const AnyIteratorImpl&>(other)._iter;
+    static void move(AnyIteratorStorage& from, AnyIteratorStorage& to) noexcept {
+        ::new (static_cast<void*>(to.buffer)) Iter*(pointer(from));
+        pointer(from) = nullptr;
     }
 
-    std::shared_ptr<AnyIteratorBase> clone() const override {
-        return std::make_shared<AnyIteratorImpl>(_iter);
+    static void destroy(AnyIteratorStorage& storage) noexcept {
+        delete pointer(storage);
     }
 };
 
-template<class Iter, class T, class Reference, class DiffType>
-class AnyIteratorImpl<Iter, T, Reference, std::bidirectional_iterator_tag, DiffType> final
-    : public IteratorBase<Reference, std::bidirectional_iterator_tag, DiffType> {
-    Iter _iter{};
-
-    static_assert(std::is_same<Reference, decltype(*_iter)>::value,
-                  "The iterator operator* returns a different type than template parameter `Reference`");
-
-    using AnyIteratorBase = IteratorBase<Reference, std::bidirectional_iterator_tag, DiffType>;
-
-public:
-    using value_type = T;
-    using reference = Reference;
-    using pointer = FakePointerProxy<reference>;
-    using difference_type = DiffType;
-    using iterator_category = std::bidirectional_iterator_tag;
+template<class Iter, class Reference, class IterCat, class DiffType>
+class AnyIteratorImpl {
+    static_assert(std::is_same<Reference, decltype(*std::declval<const Iter&>())>::value,
+                  "The iterator operator* returns a different type than template parameter `Reference`. Try adding/removing "
+                  "`&` to `Reference`");
 
-    AnyIteratorImpl() = default;
+    using Access = AnyIteratorStorageAccess<Iter>;
+    using VTable = AnyIteratorVTable<Reference, DiffType>;
 
-    AnyIteratorImpl(Iter iter) : _iter(std::move(iter)) {
+    static void copy(const AnyIteratorStorage& from, AnyIteratorStorage& to) {
+        Access::construct(to, Access::get(from));
     }
 
-    ~AnyIteratorImpl() override = default;
-
-    reference dereference() override {
-        return *_iter;
+    static Reference dereference(const AnyIteratorStorage& self) {
+        return *Access::get(self);
     }
 
-    reference dereference() const override {
-        return *_iter;
+    static void increment(AnyIteratorStorage& self) {
+        ++Access::get(self);
     }
 
-    pointer arrow() override {
-        return pointer{ dereference() };
+    static bool eq(const AnyIteratorStorage& self, const AnyIteratorStorage& other) {
+        return Access::get(self) == Access::get(other);
     }
 
-    void increment() override {
-        ++_iter;
+    static void decrement(AnyIteratorStorage& self) {
+        --Access::get(self);
     }
 
-    void decrement() override {
-        --_iter;
+    static void plusIs(AnyIteratorStorage& self, const DiffType n) {
+        Access::get(self) += n;
     }
 
-    bool eq(const AnyIteratorBase& other) const override {
-        return _iter == static_cast<const AnyIteratorImpl&>(other)._iter;
+    static DiffType minus(const AnyIteratorStorage& self, const AnyIteratorStorage& other) {
+        return Access::get(self) - Access::get(other);
     }
 
-    std::shared_ptr<AnyIteratorBase> clone() const override {
-        return std::make_shared<AnyIteratorImpl>(_iter);
+    static bool lt(const AnyIteratorStorage& self, const AnyIteratorStorage& other) {
+        return Access::get(self) < Access::get(other);
     }
-};
-
-template<class Iter, class T, class Reference, class DiffType>
-class AnyIteratorImpl<Iter, T, Reference, std::random_access_iterator_tag, DiffType> final
-    : public IteratorBase<Reference, std::random_access_iterator_tag, DiffType> {
-    Iter _iter{};
-    static_assert(std::is_same<Reference, decltype(*_iter)>::value,
-                  "The iterator operator* returns a different type than template parameter `Reference`");
 
-    using AnyIteratorBase = IteratorBase<Reference, std::random_access_iterator_tag, DiffType>;
-
-public:
-    using value_type = T;
-    using reference = Reference;
-    using pointer = FakePointerProxy<Reference>;
-    using difference_type = DiffType;
-    using iterator_category = std::random_access_iterator_tag;
+    template<class Slot>
+    static std::size_t pull(AnyIteratorStorage& self, const AnyIteratorStorage& end, Slot* out, const std::size_t n) {
+        Iter& iter = Access::get(self);
+        const Iter& last = Access::get(end);
+        std::size_t count = 0;
+        for (; count < n && iter != last; ++iter, ++count) {
+            out[count] = *iter;
+        }
+        return count;
+    }
 
-    AnyIteratorImpl() = default;
+    using Pull = decltype(VTable::pull);
 
-    AnyIteratorImpl(Iter iter) : _iter(std::move(iter)) {
+    static constexpr Pull pullFunction(std::false_type) {
+        return nullptr;
     }
 
-    ~AnyIteratorImpl() override = default;
-
-    reference dereference() override {
-        return *_iter;
+    static constexpr Pull pullFunction(std::true_type) {
+        return &pull<typename VTable::BatchSlot>;
     }
 
-    reference dereference() const override {
-        return *_iter;
+    static constexpr Pull pullFunction() {
+        return pullFunction(std::integral_constant<bool, !std::is_void<typename VTable::BatchSlot>::value>{});
     }
 
-    pointer arrow() override {
-        return pointer{ dereference() };
+    template<class Element>
+    static Element* contiguousData(const AnyIteratorStorage& self, const AnyIteratorStorage& end, std::size_t& size) {
+        const Iter& first = Access::get(self);
+        const Iter& last = Access::get(end);
+        if (first == last) {
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(last - first);
+        return std::addressof(*first);
     }
 
-    void increment() override {
-        ++_iter;
+    using ContiguousData = decltype(VTable::contiguousData);
+
+    static constexpr ContiguousData contiguousDataFunction(std::false_type) {
+        return nullptr;
     }
 
-    void decrement() override {
-        --_iter;
+    static constexpr ContiguousData contiguousDataFunction(std::true_type) {
+        return &contiguousData<typename VTable::ContiguousElement>;
     }
 
-    bool eq(const AnyIteratorBase& other) const override {
-        return _iter == static_cast<const AnyIteratorImpl&>(other)._iter;
+    static constexpr ContiguousData contiguousDataFunction() {
+        using IsContiguous =
+            std::integral_constant<bool, IsContiguousIterator<Iter>::value && std::is_lvalue_reference<Reference>::value>;
+        return contiguousDataFunction(IsContiguous{});
     }
 
-    void plusIs(DiffType n) override {
-        _iter += n;
+    static const VTable* makeVTable(std::forward_iterator_tag) {
+        static const VTable vtable = {
+            &copy, &Access::move, &Access::destroy, &dereference, &increment, &eq, nullptr, nullptr, nullptr, nullptr,
+            pullFunction(), contiguousDataFunction()
+        };
+        return &vtable;
     }
 
-    virtual DiffType minus(const AnyIteratorBase& other) const override {
-        return _iter - static_cast<const AnyIteratorImpl&>(other)._iter;
+    static const VTable* makeVTable(std::bidirectional_iterator_tag) {
+        static const VTable vtable = {
+            &copy, &Access::move, &Access::destroy, &dereference, &increment, &eq, &decrement, nullptr, nullptr, nullptr,
+            pullFunction(), contiguousDataFunction()
+        };
+        return &vtable;
     }
 
-    bool lt(const AnyIteratorBase& other) const override {
-        return _iter < static_cast<const AnyIteratorImpl&>(other)._iter;
+    static const VTable* makeVTable(std::random_access_iterator_tag) {
+        static const VTable vtable = {
+            &copy, &Access::move, &Access::destroy, &dereference, &increment, &eq, &decrement, &plusIs, &minus, &lt,
+            pullFunction(), contiguousDataFunction()
+        };
+        return &vtable;
     }
 
-    std::shared_ptr<AnyIteratorBase> clone() const override {
-        return std::make_shared<AnyIteratorImpl>(_iter);
+public:
+    // Constructs `iter` into `storage` and returns the vtable to operate on it
+    template<class I>
+    static const VTable* construct(AnyIteratorStorage& storage, I&& iter) {
+        Access::construct(storage, std::forward<I>(iter));
+        return makeVTable(IterCat{});
     }
 };
 } // namespace detail
 } // namespace lz
 
-#endif
\ No newline at end of file
+#endif
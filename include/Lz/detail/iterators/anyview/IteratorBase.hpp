@@ -4,76 +4,69 @@
 #define LZ_ANY_VIEW_ITERATOR_BASE_HPP
 
 #include "Lz/detail/FakePointerProxy.hpp"
+#include "Lz/detail/Traits.hpp"
 
+#include <cstddef>
 #include <iterator>
-#include <memory>
 #include <type_traits>
 
 namespace lz {
 namespace detail {
-template<class Reference, class IterCat, class DiffType>
-struct IteratorBase;
-
-template<class Reference, class DiffType>
-struct IteratorBase<Reference, std::forward_iterator_tag, DiffType> {
-    virtual ~IteratorBase() = default;
-
-    virtual Reference dereference() = 0;
-
-    virtual Reference dereference() const = 0;
-
-    virtual FakePointerProxy<Reference> arrow() = 0;
-
-    virtual void increment() = 0;
-
-    virtual bool eq(const IteratorBase& other) const = 0;
-
-    virtual std::shared_ptr<IteratorBase> clone() const = 0;
+/**
+ * Inline storage of a type erased iterator. Iterators that are too large, too strictly aligned or that may throw when moved are
+ * allocated on the heap instead, in which case only a pointer to them is stored here.
+ */
+struct AnyIteratorStorage {
+    static constexpr std::size_t Size = 6 * sizeof(void*);
+    static constexpr std::size_t Alignment = alignof(void*);
+
+    alignas(Alignment) unsigned char buffer[Size];
 };
 
-template<class Reference, class DiffType>
-struct IteratorBase<Reference, std::bidirectional_iterator_tag, DiffType> {
-    virtual ~IteratorBase() = default;
-
-    virtual Reference dereference() = 0;
-
-    virtual Reference dereference() const = 0;
-
-    virtual FakePointerProxy<Reference> arrow() = 0;
-
-    virtual void increment() = 0;
-
-    virtual void decrement() = 0;
-
-    virtual bool eq(const IteratorBase& other) const = 0;
-
-    virtual std::shared_ptr<IteratorBase> clone() const = 0;
+/**
+ * Elements are pulled in batches by copying them into an array of `Slot`s. This is only done if copying is cheap: if the elements
+ * are trivially copyable, or if they are returned by value so that they can be moved. Otherwise `Slot` is void.
+ */
+template<class Reference, class Value = Decay<Reference>>
+struct AnyIteratorBatch {
+    using Slot = Conditional<std::is_default_constructible<Value>::value && std::is_move_assignable<Value>::value &&
+                                 (!std::is_reference<Reference>::value || std::is_trivially_copyable<Value>::value),
+                             Value, void>;
 };
 
+/**
+ * Manual vtable of a type erased iterator. Every function receives the storage of the iterator(s) it operates on. There is one
+ * static instance per erased iterator type, so an `AnyView` iterator only holds a pointer to it next to its inline storage.
+ * Functions that the iterator category does not support are null.
+ */
 template<class Reference, class DiffType>
-struct IteratorBase<Reference, std::random_access_iterator_tag, DiffType> {
-    virtual ~IteratorBase() = default;
-
-    virtual Reference dereference() = 0;
-
-    virtual Reference dereference() const = 0;
-
-    virtual FakePointerProxy<Reference> arrow() = 0;
-
-    virtual void increment() = 0;
-
-    virtual void decrement() = 0;
-
-    virtual void plusIs(DiffType n) = 0;
-
-    virtual DiffType minus(const IteratorBase& other) const = 0;
-
-    virtual bool eq(const IteratorBase& other) const = 0;
-
-    virtual bool lt(const IteratorBase& other) const = 0;
-
-    virtual std::shared_ptr<IteratorBase> clone() const = 0;
+struct AnyIteratorVTable {
+    // Copy or move constructs the iterator in `from` into the uninitialized storage `to`. `move` also destroys `from`
+    void (*copy)(const AnyIteratorStorage& from, AnyIteratorStorage& to);
+    void (*move)(AnyIteratorStorage& from, AnyIteratorStorage& to);
+    void (*destroy)(AnyIteratorStorage& self);
+
+    Reference (*dereference)(const AnyIteratorStorage& self);
+    void (*increment)(AnyIteratorStorage& self);
+    bool (*eq)(const AnyIteratorStorage& self, const AnyIteratorStorage& other);
+
+    // Bidirectional
+    void (*decrement)(AnyIteratorStorage& self);
+
+    // Random access
+    void (*plusIs)(AnyIteratorStorage& self, DiffType n);
+    DiffType (*minus)(const AnyIteratorStorage& self, const AnyIteratorStorage& other);
+    bool (*lt)(const AnyIteratorStorage& self, const AnyIteratorStorage& other);
+
+    // Copies at most `n` elements into `out` until `end` is reached, null if the elements cannot be batched
+    using BatchSlot = typename AnyIteratorBatch<Reference>::Slot;
+    std::size_t (*pull)(AnyIteratorStorage& self, const AnyIteratorStorage& end, BatchSlot* out, std::size_t n);
+
+    // Returns the elements of [self, end) if they are contiguous and not empty, null if the erased iterator is not contiguous
+    using ContiguousElement =
+        Conditional<std::is_lvalue_reference<Reference>::value, typename std::remove_reference<Reference>::type, void>;
+    ContiguousElement* (*contiguousData)(const AnyIteratorStorage& self, const AnyIteratorStorage& end, std::size_t& size);
 };
 } // namespace detail
 } // namespace lz
-#endif // LZ_ANY_VIEW_ITERATOR_BASE_HPP
\ No newline at end of file
+#endif // LZ_ANY_VIEW_ITERATOR_BASE_HPP
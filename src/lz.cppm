@@ -2,9 +2,21 @@ module;
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <charconv>
 #include <cmath>
 #include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
 #include <execution>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -12,11 +24,15 @@ module;
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <random>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -28,13 +44,16 @@ export module lz;
 
 export {
 #include "Lz/CString.hpp"
+#include "Lz/Cache.hpp"
 #include "Lz/CartesianProduct.hpp"
 #include "Lz/ChunkIf.hpp"
 #include "Lz/Chunks.hpp"
 #include "Lz/Concatenate.hpp"
+#include "Lz/Distinct.hpp"
 #include "Lz/Enumerate.hpp"
 #include "Lz/Except.hpp"
 #include "Lz/Exclude.hpp"
+#include "Lz/Execution.hpp"
 #include "Lz/Filter.hpp"
 #include "Lz/Flatten.hpp"
 #include "Lz/FunctionTools.hpp"
@@ -45,6 +64,7 @@ export {
 #include "Lz/Loop.hpp"
 #include "Lz/Lz.hpp"
 #include "Lz/Map.hpp"
+#include "Lz/Predicates.hpp"
 #include "Lz/Random.hpp"
 #include "Lz/Range.hpp"
 #include "Lz/Repeat.hpp"
@@ -83,4 +83,131 @@ TEST_CASE("Creating a complex AnyView, std::forward_iterator_tag") {
     std::pair<int, int&> pair = *view.begin();
     CHECK(pair.first == 0);
     CHECK(pair.second == vec[0]);
-}
\ No newline at end of file
+}
+TEST_CASE("AnyView iterator storage") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("Small iterators are copied") {
+        lz::AnyView<int, int&, std::random_access_iterator_tag> view = vec;
+        auto begin = view.begin();
+        auto copy = begin++;
+        CHECK(*copy == 1);
+        CHECK(*begin == 2);
+        copy = begin + 3;
+        CHECK(*copy == 5);
+        auto moved = std::move(copy);
+        CHECK(*moved == 5);
+        CHECK(moved - begin == 3);
+    }
+
+    SECTION("Large iterators are allocated on the heap") {
+        std::array<std::int64_t, 8> offsets = { 0, 0, 0, 0, 0, 0, 0, 10 };
+        // The captured array makes this iterator larger than the inline storage
+        lz::AnyView<std::int64_t, std::int64_t> view =
+            lz::map(vec, [offsets](int i) { return static_cast<std::int64_t>(i) + offsets.back(); });
+        auto begin = view.begin();
+        auto copy = begin;
+        ++begin;
+        CHECK(*copy == 11);
+        CHECK(*begin == 12);
+        copy = std::move(begin);
+        CHECK(*copy == 12);
+        std::vector<std::int64_t> expected = { 11, 12, 13, 14, 15, 16 };
+        CHECK(view.toVector() == expected);
+    }
+
+    SECTION("Default constructed") {
+        lz::AnyView<int> view;
+        auto begin = view.begin();
+        auto copy = begin;
+        static_cast<void>(copy);
+        lz::AnyView<int> assigned = vec;
+        view = assigned;
+        CHECK(view.distance() == 6);
+    }
+}
+
+TEST_CASE("AnyView batched terminals") {
+    // More than one batch, and a last batch that is not full
+    std::vector<int> vec = lz::range(150).toVector();
+    std::vector<int> expected = vec;
+
+    SECTION("Elements by value") {
+        lz::AnyView<int, int> view = lz::map(vec, [](int i) { return i; });
+        CHECK(view.toVector() == expected);
+        std::vector<int> copied(vec.size());
+        view.copyTo(copied.begin());
+        CHECK(copied == expected);
+        CHECK(lz::chain(view).sum() == 150 * 149 / 2);
+        std::vector<int> visited;
+        lz::chain(view).forEach([&visited](int i) { visited.push_back(i); });
+        CHECK(visited == expected);
+    }
+
+    SECTION("Elements by reference are modifiable in forEach") {
+        lz::AnyView<int> view = vec;
+        CHECK(view.to<std::list>() == std::list<int>(expected.begin(), expected.end()));
+        lz::chain(view).forEach([](int& i) { i *= 2; });
+        CHECK(vec[149] == 298);
+    }
+
+    SECTION("Elements that are not batched") {
+        std::vector<std::string> strings = { "hello", "world" };
+        lz::AnyView<std::string> view = strings;
+        CHECK(view.toVector() == strings);
+        CHECK(lz::chain(view).foldl(std::string(), [](std::string acc, const std::string& s) { return acc + s; }) ==
+              "helloworld");
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        lz::AnyView<int, int> view = lz::map(empty, [](int i) { return i; });
+        CHECK(view.toVector().empty());
+        CHECK(lz::chain(view).sum() == 0);
+    }
+}
+
+TEST_CASE("AnyView contiguous terminals") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+
+    SECTION("Contiguous source") {
+        lz::AnyView<int> view = vec;
+        CHECK(view.toVector() == vec);
+        std::array<int, 5> copied{};
+        view.copyTo(copied.begin());
+        CHECK(std::equal(copied.begin(), copied.end(), vec.begin()));
+        CHECK(lz::contains(view, 4));
+        CHECK(!lz::contains(view, 6));
+        CHECK(lz::startsWith(view, std::vector<int>{ 1, 2 }));
+        CHECK(!lz::startsWith(view, std::vector<int>{ 2, 1 }));
+        CHECK(lz::chain(view).sum() == 15);
+        lz::chain(view).forEach([](int& i) { i *= 2; });
+        CHECK(vec.back() == 10);
+    }
+
+    SECTION("Bytes are searched with memchr") {
+        std::string str = "hello";
+        const std::vector<char> chars(str.begin(), str.end());
+        lz::AnyView<char, const char&> view = chars;
+        CHECK(lz::contains(view, 'l'));
+        CHECK(!lz::contains(view, 'x'));
+        // 'l' + 256 does not fit in a char, and must not be found
+        CHECK(!lz::contains(view, static_cast<int>('l') + 256));
+    }
+
+    SECTION("Non contiguous source") {
+        std::list<int> list(vec.begin(), vec.end());
+        lz::AnyView<int> view = list;
+        CHECK(view.toVector() == vec);
+        CHECK(lz::contains(view, 5));
+        CHECK(lz::chain(view).sum() == 15);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        lz::AnyView<int> view = empty;
+        CHECK(view.toVector().empty());
+        CHECK(!lz::contains(view, 1));
+        CHECK(lz::chain(view).sum() == 0);
+    }
+}
@@ -0,0 +1,102 @@
+#include <Lz/Cache.hpp>
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <string>
+
+TEST_CASE("Cache evaluates every element once", "[Cache][Basic functionality]") {
+    std::array<int, 6> arr = { 1, 2, 3, 4, 5, 6 };
+    std::size_t calls = 0;
+    auto mapped = lz::map(arr, [&calls](int i) {
+        ++calls;
+        return std::to_string(i);
+    });
+    auto cache = lz::cache(mapped);
+    CHECK(calls == 0);
+
+    SECTION("Multiple passes") {
+        CHECK(cache.distance() == 6);
+        CHECK(calls == 6);
+        CHECK(*std::max_element(cache.begin(), cache.end()) == "6");
+        std::vector<std::string> expected = { "1", "2", "3", "4", "5", "6" };
+        CHECK(cache.toVector() == expected);
+        CHECK(calls == 6);
+    }
+
+    SECTION("Lazily evaluated") {
+        auto it = cache.begin();
+        CHECK(*it == "1");
+        ++it;
+        CHECK(*it == "2");
+        CHECK(calls == 2);
+        // A copy of begin reads from the buffer
+        CHECK(*cache.begin() == "1");
+        CHECK(calls == 2);
+    }
+
+    SECTION("Indexing") {
+        CHECK(cache[3] == "4");
+        CHECK(calls == 4);
+        CHECK(cache[0] == "1");
+        CHECK(cache.size() == 6);
+        CHECK(calls == 6);
+    }
+
+    SECTION("Stable references") {
+        const std::string& first = *cache.begin();
+        const std::string* address = std::addressof(first);
+        CHECK(cache.size() == 6);
+        CHECK(std::addressof(cache[0]) == address);
+        CHECK(first == "1");
+    }
+
+    SECTION("Bidirectional") {
+        auto end = cache.end();
+        --end;
+        CHECK(*end == "6");
+        CHECK(calls == 6);
+        std::vector<std::string> expected = { "6", "5", "4", "3", "2", "1" };
+        CHECK(lz::reverse(cache).toVector() == expected);
+    }
+
+    SECTION("Random access once filled") {
+        auto filled = cache.filled();
+        static_assert(lz::detail::IsRandomAccess<decltype(filled.begin())>::value, "A filled cache must be random access");
+        CHECK(calls == 6);
+        CHECK(filled.end() - filled.begin() == 6);
+        CHECK(filled.begin()[3] == "4");
+        CHECK(*(filled.end() - 1) == "6");
+        CHECK(std::addressof(*filled.begin()) == std::addressof(cache[0]));
+        CHECK(filled.partition(1, 2).toVector() == std::vector<std::string>{ "4", "5", "6" });
+        CHECK(calls == 6);
+    }
+}
+
+TEST_CASE("Cache with more elements than a chunk", "[Cache][Basic functionality]") {
+    std::list<int> list;
+    for (int i = 0; i < 3000; ++i) {
+        list.push_back(i);
+    }
+    auto cache = lz::chain(list).filter([](int i) { return i % 3 != 0; }).cache();
+    const int* first = std::addressof(*cache.begin());
+    CHECK(cache.distance() == 2000);
+    CHECK(std::addressof(*cache.begin()) == first);
+    CHECK(cache.foldl(0, std::plus<int>()) == lz::chain(list).filter([](int i) { return i % 3 != 0; }).sum());
+
+
+    auto filled = lz::cache(list).filled();
+    CHECK(filled.end() - filled.begin() == 3000);
+    CHECK(filled.begin()[2500] == 2500);
+    CHECK(filled.partition(2, 3).toVector() == lz::range(2000, 3000).toVector());
+    // The buffer is only read, so the parts can be iterated by multiple threads at once
+    CHECK(lz::parallelReduce(filled, 0, std::plus<int>(), std::plus<int>(), lz::execution::pool(4)) == 2999 * 3000 / 2);
+}
+
+TEST_CASE("Empty cache", "[Cache][Edge cases]") {
+    std::vector<int> vec;
+    auto cache = lz::cache(vec);
+    CHECK(cache.empty());
+    CHECK(cache.size() == 0);
+    CHECK(cache.begin() == cache.end());
+    CHECK(cache.filled().begin() == cache.filled().end());
+}
@@ -1,7 +1,22 @@
 #include <Lz/Concatenate.hpp>
 #include <catch2/catch.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Lz.hpp>
 #include <list>
 
+namespace {
+struct SegmentCounter {
+    std::size_t count = 0;
+
+    template<class Iterator>
+    bool operator()(const Iterator& first, const Iterator& last) {
+        CHECK(first != last);
+        ++count;
+        return true;
+    }
+};
+} // namespace
+
 TEST_CASE("Concat changing and creating elements", "[Concat][Basic functionality]") {
     std::string a = "hello ";
     std::string b = "world";
@@ -32,6 +47,74 @@ TEST_CASE("Concat changing and creating elements", "[Concat][Basic functionality
     }
 }
 
+TEST_CASE("Terminal operations loop over one sequence after another", "[Concat][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::vector<int> b;
+    std::vector<int> c = { 4, 5 };
+    auto concat = lz::concat(a, b, c);
+
+    SECTION("Foldl") {
+        CHECK(lz::chain(concat).sum() == 15);
+    }
+
+    SECTION("From the middle") {
+        auto begin = concat.begin();
+        std::advance(begin, 3);
+        CHECK(lz::chainRange(begin, concat.end()).toVector() == std::vector<int>{ 4, 5 });
+        CHECK(lz::chainRange(concat.begin(), begin).toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(lz::chainRange(std::next(concat.begin()), std::next(begin)).toVector() == std::vector<int>{ 2, 3, 4 });
+    }
+
+    SECTION("Any stops at the first match") {
+        std::size_t calls = 0;
+        CHECK(lz::chain(concat).any([&calls](const int i) {
+            ++calls;
+            return i == 4;
+        }));
+        CHECK(calls == 4);
+    }
+
+    SECTION("Of filters") {
+        auto isOdd = [](const int i) {
+            return i % 2 != 0;
+        };
+        auto filters = lz::concat(lz::filter(a, isOdd), lz::filter(b, isOdd), lz::filter(c, isOdd));
+        CHECK(lz::chain(filters).sum() == 9);
+        CHECK(filters.toVector() == std::vector<int>{ 1, 3, 5 });
+    }
+}
+
+TEST_CASE("Concatenate is traversed one sequence at a time", "[Concat][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::vector<int> b;
+    std::vector<int> c = { 4, 5 };
+    auto concat = lz::concat(a, b, c);
+
+    SECTION("Empty sequences are skipped") {
+        SegmentCounter counter;
+        CHECK(concat.begin().segments(concat.end(), counter));
+        CHECK(counter.count == 2);
+    }
+
+    SECTION("Partial sequences") {
+        SegmentCounter counter;
+        auto begin = std::next(concat.begin());
+        CHECK(begin.segments(std::next(begin, 3), counter));
+        CHECK(counter.count == 2);
+    }
+
+    SECTION("Copy into a pointer") {
+        std::array<int, 5> copied{};
+        concat.copyTo(copied.data());
+        CHECK(copied == std::array<int, 5>{ 1, 2, 3, 4, 5 });
+    }
+
+    SECTION("To containers") {
+        CHECK(concat.toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+        CHECK(concat.to<std::list>() == std::list<int>{ 1, 2, 3, 4, 5 });
+    }
+}
+
 TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
     std::string a = "hello ", b = "world";
     auto concat = lz::concat(a, b);
@@ -63,6 +146,7 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
 
     SECTION("Operator+(int), tests += as well") {
         CHECK(*(begin + static_cast<std::ptrdiff_t>(a.size())) == 'w');
+        CHECK(*(begin + static_cast<std::ptrdiff_t>(a.size() + 1)) == 'o');
     }
 
     SECTION("Operator-(int), tests -= as well") {
@@ -113,6 +113,13 @@ TEST_CASE("CString to containers", "[CString][To container]") {
         CHECK(str.to<std::list>() == expected);
     }
 
+    SECTION("To string") {
+        const char* s = "Hello, World!";
+        CHECK(str.to<std::string>() == s);
+        CHECK(lz::cString(s, s + 5).to<std::string>() == "Hello");
+        CHECK(lz::cString("").to<std::string>().empty());
+    }
+
     SECTION("To map") {
         std::map<char, char> expected = { { '1', '1' }, { '2', '2' }, { '3', '3' }, { '4', '4' }, { '5', '5' },
                                           { '6', '6' }, { '7', '7' }, { '8', '8' }, { '9', '9' } };
@@ -0,0 +1,103 @@
+#include <Lz/Distinct.hpp>
+#include <catch2/catch.hpp>
+#include <cctype>
+#include <list>
+#include <string>
+
+TEST_CASE("Distinct changing and creating elements", "[Distinct][Basic functionality]") {
+    std::array<int, 7> arr = { 3, 2, 3, 1, 2, 4, 3 };
+    auto distinct = lz::distinct(arr);
+    auto beg = distinct.begin();
+    constexpr std::size_t size = 4;
+
+    REQUIRE(*beg == 3);
+    REQUIRE(static_cast<std::size_t>(std::distance(beg, distinct.end())) == size);
+
+    SECTION("Should keep the first occurrences in order") {
+        std::array<int, size> expected = { 3, 2, 1, 4 };
+        CHECK(expected == distinct.toArray<size>());
+    }
+
+    SECTION("Custom hash and equality") {
+        std::vector<std::string> words = { "a", "B", "A", "b", "c" };
+        auto lower = [](const std::string& s) {
+            return static_cast<char>(std::tolower(s.front()));
+        };
+        auto caseInsensitive = lz::distinct(
+            words, [lower](const std::string& s) { return std::hash<char>()(lower(s)); },
+            [lower](const std::string& a, const std::string& b) { return lower(a) == lower(b); });
+        std::vector<std::string> expected = { "a", "B", "c" };
+        CHECK(caseInsensitive.toVector() == expected);
+    }
+
+    SECTION("Distinct by key") {
+        std::vector<std::pair<int, int>> pairs = { { 1, 0 }, { 2, 1 }, { 1, 2 }, { 3, 3 }, { 2, 4 } };
+        auto byFirst = lz::distinctBy(pairs, [](const std::pair<int, int>& p) { return p.first; });
+        std::vector<std::pair<int, int>> expected = { { 1, 0 }, { 2, 1 }, { 3, 3 } };
+        CHECK(byFirst.toVector() == expected);
+    }
+
+    SECTION("Large amount of keys") {
+        std::vector<int> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+            values.push_back(i * 1024);
+            values.push_back(i);
+        }
+        // 0 is both i and i * 1024, all other multiples of 1024 are larger than 999
+        CHECK(lz::distinct(values).toVector().size() == 1999);
+    }
+}
+
+TEST_CASE("Distinct binary operations", "[Distinct][Binary ops]") {
+    std::list<int> list = { 3, 2, 3, 1, 2 };
+    auto distinct = lz::distinct(list);
+    auto beg = distinct.begin();
+
+    SECTION("Operator++") {
+        ++beg;
+        CHECK(*beg == 2);
+        ++beg;
+        CHECK(*beg == 1);
+    }
+
+    SECTION("Operator==, operator!=") {
+        CHECK(beg != distinct.end());
+        beg = distinct.end();
+        CHECK(beg == distinct.end());
+    }
+
+    SECTION("Copies and multiple passes") {
+        auto first = distinct.begin();
+        auto second = first;
+        ++first;
+        ++first;
+        CHECK(*first == 1);
+        CHECK(*second == 3);
+        ++second;
+        CHECK(*second == 2);
+        CHECK(std::distance(distinct.begin(), distinct.end()) == 3);
+        CHECK(std::distance(distinct.begin(), distinct.end()) == 3);
+    }
+}
+
+TEST_CASE("Distinct to container", "[Distinct][To container]") {
+    std::vector<int> vec = { 3, 2, 3, 1 };
+    auto distinct = lz::distinct(vec);
+
+    SECTION("To vector") {
+        std::vector<int> expected = { 3, 2, 1 };
+        CHECK(distinct.toVector() == expected);
+    }
+
+    SECTION("To other container using to<>()") {
+        std::list<int> expected = { 3, 2, 1 };
+        CHECK(distinct.to<std::list>() == expected);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto distinctEmpty = lz::distinct(empty);
+        CHECK(distinctEmpty.begin() == distinctEmpty.end());
+    }
+}
@@ -102,3 +102,47 @@ TEST_CASE("Except to containers", "[Except][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("Hash except", "[Except][Hash except]") {
+    std::vector<int> array{ 5, 1, 2, 3, 4, 5, 3 };
+    std::list<int> toExcept{ 5, 3, 5 };
+
+    SECTION("Unsorted exclusion set") {
+        auto except = lz::hashExcept(array, toExcept);
+        CHECK(except.toVector() == std::vector<int>{ 1, 2, 4 });
+        auto it = except.begin();
+        *it = 0;
+        CHECK(array[1] == 0);
+    }
+
+    SECTION("Copies share the set") {
+        auto except = lz::hashExcept(array, toExcept);
+        auto copy = except;
+        CHECK(std::distance(copy.begin(), copy.end()) == 3);
+        CHECK(*copy.begin() == 1);
+    }
+
+    SECTION("Both sorted, merged") {
+        std::vector<int> sorted = lz::range(100).toVector();
+        std::vector<int> sortedToExcept = { -1, 0, 0, 2, 3, 50, 98, 200 };
+        auto except = lz::hashExcept(sorted, sortedToExcept, lz::sorted);
+        std::vector<int> expected;
+        for (int i = 0; i < 100; ++i) {
+            if (i != 0 && i != 2 && i != 3 && i != 50 && i != 98) {
+                expected.push_back(i);
+            }
+        }
+        CHECK(except.toVector() == expected);
+        CHECK(lz::hashExcept(sorted, sortedToExcept).toVector() == expected);
+
+        // Forward sequences can be merged too
+        std::list<int> sortedList(sortedToExcept.begin(), sortedToExcept.end());
+        CHECK(lz::hashExcept(sorted, sortedList, lz::sorted).toVector() == expected);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        CHECK(lz::hashExcept(array, empty).toVector() == array);
+        CHECK(lz::hashExcept(empty, toExcept).toVector().empty());
+    }
+}
@@ -0,0 +1,322 @@
+#include "Lz/Lz.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("Pool policy terminal operations", "[Execution]") {
+    const auto pool = lz::execution::pool(4);
+    std::vector<int> vec = lz::range(10000).toVector();
+    auto view = lz::chain(vec);
+    auto isEven = [](int i) {
+        return i % 2 == 0;
+    };
+
+    SECTION("Folds") {
+        CHECK(view.sum(pool) == std::accumulate(vec.begin(), vec.end(), 0));
+        CHECK(view.foldl(0, std::plus<>(), pool) == view.sum());
+        CHECK(view.foldr(0, std::plus<>(), pool) == view.sum());
+        CHECK(view.mean(std::plus<>(), pool) == Approx(4999.5));
+    }
+
+    SECTION("Predicates and counting") {
+        CHECK(view.all([](int i) { return i < 10000; }, pool));
+        CHECK(!view.all(isEven, pool));
+        CHECK(view.any([](int i) { return i == 9999; }, pool));
+        CHECK(view.none([](int i) { return i < 0; }, pool));
+        CHECK(view.count(42, pool) == 1);
+        CHECK(view.countIf(isEven, pool) == 5000);
+        CHECK(lz::contains(vec, 9999, pool));
+        CHECK(lz::indexOf(vec, 1234, pool) == 1234);
+        CHECK(lz::indexOfIf(vec, [](int i) { return i > 7000; }, pool) == 7001);
+        CHECK(lz::indexOf(vec, -1, pool) == lz::npos);
+    }
+
+    SECTION("Min and max return the first of equal elements") {
+        std::vector<int> repeated(1000, 3);
+        repeated[500] = 1;
+        repeated[700] = 1;
+        repeated[100] = 5;
+        repeated[900] = 5;
+        auto repeatedView = lz::chain(repeated);
+        CHECK(&repeatedView.min(std::less<>(), pool) == &repeated[500]);
+        CHECK(&repeatedView.max(std::less<>(), pool) == &repeated[100]);
+    }
+
+    SECTION("Sorting") {
+        std::vector<int> reversed(vec.rbegin(), vec.rend());
+        auto reversedView = lz::chain(reversed);
+        CHECK(!reversedView.isSorted(std::less<>(), pool));
+        reversedView.sort(std::less<>(), pool);
+        CHECK(reversed == vec);
+        CHECK(reversedView.isSorted(std::less<>(), pool));
+
+        // Only the pairs that span two partitions are out of order, which the slices of a filter cannot reach by incrementing
+        std::vector<int> sawtooth(1000);
+        for (std::size_t i = 0; i < sawtooth.size(); ++i) {
+            sawtooth[i] = static_cast<int>(i % 125);
+        }
+        auto all = lz::chain(sawtooth).filter([](int) { return true; });
+        CHECK(!all.isSorted());
+        CHECK(!all.isSorted(std::less<>(), lz::execution::pool(4).chunks(8)));
+        CHECK(!all.isSorted(std::less<>(), pool));
+        auto head = lz::chain(sawtooth).filter([](int i) { return i < 1000; }).take(125);
+        CHECK(head.isSorted(std::less<>(), lz::execution::pool(4).chunks(8)));
+        CHECK(view.filter(isEven).isSorted(std::less<>(), lz::execution::pool(4).chunks(8)));
+    }
+
+    SECTION("Copying") {
+        CHECK(view.toVector(pool) == vec);
+        std::vector<int> copied(vec.size());
+        view.copyTo(copied.begin(), pool);
+        CHECK(copied == vec);
+        std::vector<int> doubled(vec.size());
+        view.transformTo(doubled.begin(), [](int i) { return i * 2; }, pool);
+        CHECK(doubled[5000] == 10000);
+        CHECK(lz::equal(vec, copied, std::equal_to<>(), pool));
+        copied.back() = 0;
+        CHECK(!lz::equal(vec, copied, std::equal_to<>(), pool));
+    }
+
+    SECTION("Forward views are split by their underlying sequence") {
+        auto filter = view.filter(isEven);
+        CHECK(filter.toVector(pool) == filter.toVector());
+        CHECK(filter.sum(pool) == filter.sum());
+        CHECK(filter.countIf([](int i) { return i % 3 == 0; }, pool) == 1667);
+        CHECK(filter.min(std::greater<>(), pool) == 9998);
+        CHECK(lz::indexOf(filter, 200, pool) == 100);
+
+        std::atomic<int> counter{ 0 };
+        filter.forEach([&counter](int) { ++counter; }, pool);
+        CHECK(counter == 5000);
+    }
+
+    SECTION("Sequences that cannot be split run on the calling thread") {
+        auto generator = lz::generate([](int& i) { return i++; }, 100, 0);
+        const auto caller = std::this_thread::get_id();
+        bool sameThread = true;
+        lz::chain(generator).forEach(
+            [&sameThread, caller](int) { sameThread = sameThread && std::this_thread::get_id() == caller; }, pool);
+        CHECK(sameThread);
+    }
+
+    SECTION("Joins and aggregates") {
+        auto identity = [](int i) {
+            return i;
+        };
+        auto joined = lz::hashJoinWhere(vec, vec, identity, identity, [](int a, int) { return a; }, pool);
+        CHECK(joined.toVector() == vec);
+
+        auto aggregated = lz::groupByAggregate(
+            vec, [](int i) { return i % 7; }, 0LL, [](long long total, int i) { return total + i; },
+            [](long long a, long long b) { return a + b; }, pool);
+        CHECK(aggregated.toVector() == lz::groupByAggregate(vec, [](int i) { return i % 7; }, 0LL,
+                                                          [](long long total, int i) { return total + i; })
+                                           .toVector());
+    }
+
+    SECTION("Nested operations") {
+        std::vector<int> outer = lz::range(16).toVector();
+        std::vector<int> inner = lz::range(1000).toVector();
+        std::atomic<long long> total{ 0 };
+        lz::chain(outer).forEach([&total, &inner, &pool](int) { total += lz::chain(inner).sum(pool); }, pool);
+        CHECK(total == 16 * 499500LL);
+    }
+
+    SECTION("Exceptions are rethrown by the caller") {
+        auto throwing = [](int i) {
+            if (i == 500) {
+                throw std::runtime_error("500");
+            }
+        };
+        CHECK_THROWS_AS(view.forEach(throwing, pool), std::runtime_error);
+        CHECK(view.sum(pool) == 49995000);
+    }
+}
+
+TEST_CASE("Pool policy chunks", "[Execution]") {
+    std::vector<double> values;
+    for (int i = 1; i <= 5000; ++i) {
+        values.push_back(1.0 / i);
+    }
+    auto view = lz::chain(values);
+
+    SECTION("A fixed amount of chunks gives the same result for any amount of threads") {
+        const double two = view.sum(lz::execution::pool(2).chunks(16));
+        const double four = view.sum(lz::execution::pool(4).chunks(16));
+        const double global = view.sum(lz::execution::pool().chunks(16));
+        CHECK(two == four);
+        CHECK(two == global);
+    }
+}
+#endif // LZ_HAS_EXECUTION
+
+TEST_CASE("Thread pool", "[Execution]") {
+    auto runCounts = [](const lz::execution::PoolPolicy& pool, const std::size_t count) {
+        std::vector<int> counts(count);
+        pool.threadPool().run(count, [&counts](std::size_t index) { ++counts[index]; });
+        return counts;
+    };
+
+    SECTION("Every index is run once") {
+        CHECK(runCounts(lz::execution::pool(4), 1000) == std::vector<int>(1000, 1));
+        CHECK(runCounts(lz::execution::pool(4), 1) == std::vector<int>(1, 1));
+        CHECK(runCounts(lz::execution::pool(4), 0).empty());
+    }
+
+    SECTION("Single thread") {
+        const auto pool = lz::execution::pool(1);
+        const auto caller = std::this_thread::get_id();
+        bool sameThread = true;
+        CHECK(pool.threadPool().threadCount() == 1);
+        pool.threadPool().run(100, [&sameThread, caller](std::size_t) {
+            sameThread = sameThread && std::this_thread::get_id() == caller;
+        });
+        CHECK(sameThread);
+    }
+
+    SECTION("Nested operations") {
+        const auto pool = lz::execution::pool(2);
+        std::atomic<long long> total{ 0 };
+        pool.threadPool().run(16, [&total, &pool](std::size_t) {
+            pool.threadPool().run(1000, [&total](std::size_t index) { total += static_cast<long long>(index); });
+        });
+        CHECK(total == 16 * 499500LL);
+    }
+
+    SECTION("Exceptions are rethrown by the caller") {
+        const auto pool = lz::execution::pool(4);
+        auto throwing = [](std::size_t index) {
+            if (index == 500) {
+                throw std::runtime_error("500");
+            }
+        };
+        CHECK_THROWS_AS(pool.threadPool().run(1000, throwing), std::runtime_error);
+        CHECK(runCounts(pool, 1000) == std::vector<int>(1000, 1));
+    }
+
+    SECTION("Every chunk is a separate task") {
+        std::atomic<int> tasks{ 0 };
+        const auto policy = lz::execution::pool(3).chunks(5);
+        CHECK(policy.chunkCount() == 5);
+        lz::detail::forEachIndex(policy, policy.chunkCount(), [&tasks](std::size_t) { ++tasks; });
+        CHECK(tasks == 5);
+        CHECK(lz::execution::pool(3).chunks(0).chunkCount() == 1);
+    }
+
+    SECTION("Default pool") {
+        CHECK(lz::execution::pool().threadPool().threadCount() >= 1);
+        CHECK(&lz::execution::pool().threadPool() == &lz::execution::pool().threadPool());
+        CHECK(runCounts(lz::execution::pool(), 100) == std::vector<int>(100, 1));
+    }
+}
+
+TEST_CASE("Splitting views", "[Execution]") {
+    std::vector<int> vec = lz::range(100).toVector();
+    auto isEven = [](int i) {
+        return i % 2 == 0;
+    };
+    auto joined = [](const auto& parts) {
+        std::vector<int> result;
+        for (const auto& part : parts) {
+            for (auto&& value : part) {
+                result.push_back(value);
+            }
+        }
+        return result;
+    };
+
+    SECTION("Random access views") {
+        auto view = lz::chain(vec);
+        auto parts = view.split(7);
+        REQUIRE(parts.size() == 7);
+        CHECK(joined(parts) == vec);
+        CHECK(parts[0].toVector() == lz::range(14).toVector());
+        CHECK(view.partition(6, 7).toVector() == lz::range(85, 100).toVector());
+        CHECK(lz::chain(vec).map([](int i) { return i * 2; }).split(3)[1].toVector() == lz::range(66, 132, 2).toVector());
+    }
+
+    SECTION("Filters") {
+        auto filter = lz::chain(vec).filter(isEven);
+        auto parts = filter.split(4);
+        CHECK(joined(parts) == filter.toVector());
+        CHECK(parts[1].toVector() == lz::range(26, 50, 2).toVector());
+        CHECK(joined(lz::chain(vec).filter(isEven).split(1000)) == filter.toVector());
+    }
+
+    SECTION("Concatenations of filters") {
+        std::vector<int> other = lz::range(100, 150).toVector();
+        auto concat = lz::concat(lz::filter(vec, isEven), lz::filter(other, isEven), lz::filter(vec, isEven));
+        const auto expected = concat.toVector();
+        for (std::size_t parts : { 1, 2, 3, 5, 16 }) {
+            CHECK(joined(lz::chain(concat).split(parts)) == expected);
+        }
+        CHECK(lz::chain(concat).partition(1, 3).toVector() == lz::range(100, 150, 2).toVector());
+    }
+
+    SECTION("Cartesian products") {
+        std::vector<char> chars = { 'a', 'b', 'c' };
+        std::function<bool(int)> even = isEven;
+        auto product = lz::chain(lz::cartesian(lz::filter(vec, even), chars));
+        auto parts = product.split(5);
+        CHECK(lz::concat(parts[0], parts[1], parts[2], parts[3], parts[4]).toVector() == product.toVector());
+        CHECK(parts[0].toVector().size() == 30);
+        CHECK(std::get<0>(*parts[4].begin()) == 80);
+    }
+}
+
+TEST_CASE("Parallel reduce", "[Execution]") {
+    std::vector<int> vec = lz::range(1000).toVector();
+    auto append = [](std::string text, int i) {
+        return text + static_cast<char>('a' + i % 26);
+    };
+    auto concat = [](std::string left, const std::string& right) {
+        return left + right;
+    };
+    const std::string expected = std::accumulate(vec.begin(), vec.end(), std::string(), append);
+
+    SECTION("Parts are folded and combined in order") {
+        CHECK(lz::parallelReduce(vec, std::string(), append, concat, lz::execution::pool(4)) == expected);
+        CHECK(lz::parallelReduce(vec, std::string(), append, concat, lz::execution::pool(3).chunks(1000)) == expected);
+        CHECK(lz::parallelReduce(vec.begin(), vec.end(), std::string(), append, concat) == expected);
+#ifdef LZ_HAS_EXECUTION
+        CHECK(lz::parallelReduce(vec, std::string(), append, concat, std::execution::par) == expected);
+        CHECK(lz::parallelReduce(vec, std::string(), append, concat, std::execution::seq) == expected);
+#endif // LZ_HAS_EXECUTION
+    }
+
+    SECTION("Accumulating into a container") {
+        using Histogram = std::vector<int>;
+        auto count = [](Histogram histogram, int i) {
+            ++histogram[static_cast<std::size_t>(i % 10)];
+            return histogram;
+        };
+        auto merge = [](Histogram left, const Histogram& right) {
+            for (std::size_t i = 0; i < left.size(); ++i) {
+                left[i] += right[i];
+            }
+            return left;
+        };
+        auto filter = lz::chain(vec).filter([](int i) { return i % 4 != 0; });
+        CHECK(filter.parallelReduce(Histogram(10), count, merge, lz::execution::pool(4)) ==
+              Histogram{ 50, 100, 50, 100, 50, 100, 50, 100, 50, 100 });
+    }
+
+    SECTION("Sequences that cannot be split are folded without combining") {
+        auto generator = lz::generate([](int& i) { return i++; }, 1000, 0);
+        auto throwing = [](std::string, const std::string&) -> std::string {
+            throw std::logic_error("combine");
+        };
+        CHECK(lz::parallelReduce(generator, std::string(), append, throwing) == expected);
+    }
+
+    SECTION("Empty sequences") {
+        CHECK(lz::parallelReduce(std::vector<int>(), std::string(), append, concat).empty());
+        CHECK(lz::parallelReduce(std::vector<int>(), 0, std::plus<>(), std::plus<>(), lz::execution::pool(2)) == 0);
+    }
+}
@@ -1,6 +1,11 @@
 #include <Lz/Filter.hpp>
+#include <Lz/Lz.hpp>
+#include <Lz/Predicates.hpp>
 #include <catch2/catch.hpp>
+#include <cmath>
+#include <limits>
 #include <list>
+#include <string>
 
 TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]") {
     constexpr size_t size = 3;
@@ -33,6 +38,134 @@ TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]")
     }
 }
 
+TEST_CASE("Filter searches the first match only once", "[Filter][Basic functionality]") {
+    std::array<int, 5> array{ 0, 0, 0, 0, 1 };
+    std::size_t calls = 0;
+    auto filter = lz::filter(array, [&calls](int element) {
+        ++calls;
+        return element == 1;
+    });
+    CHECK(calls == array.size());
+
+    for (int i = 0; i < 10; ++i) {
+        CHECK(*filter.begin() == 1);
+        CHECK(!filter.empty());
+    }
+    CHECK(calls == array.size());
+}
+
+TEST_CASE("Filter of a map calls the function once per element", "[Filter][Basic functionality]") {
+    std::array<int, 6> array{ 1, 2, 3, 4, 5, 6 };
+    std::size_t calls = 0;
+    auto map = lz::map(array, [&calls](int i) {
+        ++calls;
+        return std::to_string(i);
+    });
+    auto filter = lz::filter(map, [](const std::string& s) { return s != "3"; });
+
+    // The first element is mapped when the view is constructed
+    CHECK(calls == 1);
+
+    calls = 0;
+    auto it = filter.begin();
+    ++it;
+    ++it;
+    CHECK(calls == 3);
+    // The result the predicate was tested on is handed out
+    CHECK(*it == "4");
+    CHECK(calls == 3);
+    // Reading it again, or through a copy, hands out the kept result again
+    CHECK(*it == "4");
+    auto copy = it;
+    CHECK(*copy == "4");
+    CHECK(calls == 3);
+
+    calls = 0;
+    std::vector<std::string> expected = { "1", "2", "4", "5", "6" };
+    CHECK(filter.toVector() == expected);
+    // begin() is a copy of the iterator the view positioned on the first match, so the first element is not mapped again
+    CHECK(calls == array.size() - 1);
+
+    calls = 0;
+    std::vector<std::string> iterated;
+    for (const std::string& s : filter) {
+        iterated.push_back(s);
+    }
+    CHECK(iterated == expected);
+    CHECK(calls == array.size() - 1);
+
+    calls = 0;
+    auto chained = lz::chain(array)
+                       .map([&calls](int i) {
+                           ++calls;
+                           return i * 2;
+                       })
+                       .filter([](int i) { return i > 4; })
+                       .filter([](int i) { return i < 12; });
+    calls = 0;
+    CHECK(chained.toVector() == std::vector<int>{ 6, 8, 10 });
+    // The elements after the first match, which was mapped when the view was constructed
+    CHECK(calls == 3);
+}
+
+TEST_CASE("Filter of a map returns its elements by value", "[Filter][Basic functionality]") {
+    std::array<int, 4> array{ 1, 2, 3, 4 };
+    // Long enough not to fit in the small buffer of std::string, so that reading a destroyed element is noticed
+    auto toString = [](int i) {
+        return std::string(32, static_cast<char>('a' + i));
+    };
+    auto filter = lz::chain(array).map(toString).filter([](const std::string& s) { return s[0] != 'b'; });
+    static_assert(!std::is_reference<decltype(*filter.begin())>::value, "The element of the map is not a reference");
+
+    const std::string front = filter.front();
+    CHECK(front == toString(2));
+    CHECK(filter.max() == toString(4));
+    CHECK(filter.min() == toString(2));
+    const auto& first = *filter.begin();
+    CHECK(first == toString(2));
+}
+
+TEST_CASE("Terminal operations drive a filter themselves", "[Filter][Basic functionality]") {
+    std::list<int> list = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::size_t calls = 0;
+    auto filter = lz::filter(list, [&calls](const int i) {
+        ++calls;
+        return i % 2 == 0;
+    });
+    // The first match is found when the view is created
+    calls = 0;
+
+    SECTION("Foldl") {
+        CHECK(lz::chain(filter).sum() == 20);
+        CHECK(calls == 6);
+    }
+
+    SECTION("For each by reference") {
+        lz::chain(filter).forEach([](int& i) { i *= 10; });
+        CHECK(list == std::list<int>{ 1, 20, 3, 40, 5, 60, 7, 80 });
+    }
+
+    SECTION("Copy") {
+        std::vector<int> copied;
+        filter.copyTo(std::back_inserter(copied));
+        CHECK(copied == std::vector<int>{ 2, 4, 6, 8 });
+        CHECK(calls == 6);
+    }
+
+    SECTION("Any, all and none stop at the first match") {
+        CHECK(lz::chain(filter).any([](const int i) { return i == 4; }));
+        CHECK(calls == 2);
+        CHECK(!lz::chain(filter).all([](const int i) { return i < 4; }));
+        CHECK(lz::chain(filter).none([](const int i) { return i > 8; }));
+    }
+
+    SECTION("Nested") {
+        auto nested = lz::chain(list).map([](const int i) { return i * 3; }).filter([](const int i) { return i % 2 == 0; });
+        CHECK(lz::filter(nested, [](const int i) { return i > 6; }).toVector() == std::vector<int>{ 12, 18, 24 });
+        CHECK(nested.sum() == 60);
+    }
+}
+
 TEST_CASE("Filter binary operations", "[Filter][Binary ops]") {
     constexpr std::size_t size = 3;
     std::array<int, size> array{ 1, 2, 3 };
@@ -108,3 +241,77 @@ TEST_CASE("Filter to container", "[Filter][To container]") {
         CHECK(expected == actual);
     }
 }
+
+TEST_CASE("Filter with predicates from lz::pred", "[Filter][Predicates]") {
+    std::vector<float> floats;
+    std::vector<std::int32_t> ints;
+    std::vector<double> doubles;
+    // Not a multiple of any vector width, and more matches than fit in a single batch
+    for (std::int32_t i = 0; i < 1003; ++i) {
+        const std::int32_t value = (i * 7919) % 201 - 100;
+        floats.push_back(static_cast<float>(value) / 4.f);
+        ints.push_back(value);
+        doubles.push_back(static_cast<double>(value) / 8.);
+    }
+
+#ifdef LZ_HAS_SIMD
+    static_assert(lz::detail::HasBatchedPull<decltype(lz::filter(floats, lz::pred::lt(1.f)).begin())>::value,
+                  "Predicates from lz::pred over contiguous floats should be vectorized");
+#endif
+
+    const auto expected = [](const std::vector<float>& vec, const std::function<bool(float)>& predicate) {
+        std::vector<float> result;
+        std::copy_if(vec.begin(), vec.end(), std::back_inserter(result), predicate);
+        return result;
+    };
+
+    SECTION("Comparisons") {
+        CHECK(lz::filter(floats, lz::pred::lt(1.5f)).toVector() == expected(floats, [](float f) { return f < 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::le(1.5f)).toVector() == expected(floats, [](float f) { return f <= 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::gt(1.5f)).toVector() == expected(floats, [](float f) { return f > 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::ge(1.5f)).toVector() == expected(floats, [](float f) { return f >= 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::eq(1.5f)).toVector() == expected(floats, [](float f) { return f == 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::ne(1.5f)).toVector() == expected(floats, [](float f) { return f != 1.5f; }));
+        CHECK(lz::filter(floats, lz::pred::between(-2.f, 3.f)).toVector() ==
+              expected(floats, [](float f) { return -2.f <= f && f <= 3.f; }));
+    }
+
+    SECTION("Combined") {
+        auto filter = lz::filter(floats, (lz::pred::gt(-10.f) && lz::pred::lt(10.f)) || lz::pred::eq(25.f));
+        CHECK(filter.toVector() == expected(floats, [](float f) { return (f > -10.f && f < 10.f) || f == 25.f; }));
+        CHECK(filter.distance() == static_cast<std::ptrdiff_t>(filter.toVector().size()));
+    }
+
+    SECTION("Integers and doubles") {
+        auto intFilter = lz::filter(ints, lz::pred::ge(0) && lz::pred::ne(50));
+        std::vector<std::int32_t> expectedInts;
+        std::copy_if(ints.begin(), ints.end(), std::back_inserter(expectedInts),
+                     [](std::int32_t i) { return i >= 0 && i != 50; });
+        CHECK(intFilter.toVector() == expectedInts);
+        CHECK(intFilter.distance() == static_cast<std::ptrdiff_t>(expectedInts.size()));
+
+        auto doubleFilter = lz::filter(doubles, lz::pred::le(-1.));
+        std::vector<double> expectedDoubles;
+        std::copy_if(doubles.begin(), doubles.end(), std::back_inserter(expectedDoubles), [](double d) { return d <= -1.; });
+        std::vector<double> copied(expectedDoubles.size());
+        doubleFilter.copyTo(copied.begin());
+        CHECK(copied == expectedDoubles);
+    }
+
+    SECTION("NaN") {
+        std::vector<float> withNan = { 1.f, std::numeric_limits<float>::quiet_NaN(), 2.f, 3.f, 4.f, 5.f };
+        CHECK(lz::filter(withNan, lz::pred::lt(10.f)).distance() == 5);
+        CHECK(lz::filter(withNan, lz::pred::ne(2.f)).distance() == 5);
+    }
+
+    SECTION("Generic iterators and other types still work") {
+        std::list<float> list(floats.begin(), floats.end());
+        CHECK(lz::filter(list, lz::pred::lt(1.5f)).toVector() == expected(floats, [](float f) { return f < 1.5f; }));
+        // The value is a double, so the predicate is not vectorized
+        CHECK(lz::filter(floats, lz::pred::lt(1.5)).toVector() == expected(floats, [](float f) { return f < 1.5; }));
+        auto filter = lz::filter(floats, lz::pred::lt(0.f));
+        CHECK(*filter.begin() == floats[std::distance(floats.begin(), std::find_if(floats.begin(), floats.end(),
+                                                                                    [](float f) { return f < 0.f; }))]);
+    }
+}
+
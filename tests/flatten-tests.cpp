@@ -1,9 +1,23 @@
 #include "Lz/FunctionTools.hpp"
 
 #include <Lz/Flatten.hpp>
+#include <Lz/Lz.hpp>
 #include <catch2/catch.hpp>
 #include <list>
 
+namespace {
+struct SegmentCounter {
+    std::size_t count = 0;
+
+    template<class Iterator>
+    bool operator()(const Iterator& first, const Iterator& last) {
+        CHECK(first != last);
+        ++count;
+        return true;
+    }
+};
+} // namespace
+
 TEST_CASE("Should flatten", "[Flatten][Basic functionality]") {
     SECTION("Flatten 1D") {
         std::vector<int> vec = { 1, 2, 3, 4 };
@@ -37,6 +51,61 @@ TEST_CASE("Should flatten", "[Flatten][Basic functionality]") {
     }
 }
 
+TEST_CASE("Terminal operations loop over one inner sequence after another", "[Flatten][Basic functionality]") {
+    std::vector<std::vector<std::vector<int>>> vecs = { { { 1, 2 }, {} }, {}, { { 3 }, {}, { 4, 5 } } };
+    auto flattened = lz::flatten(vecs);
+
+    SECTION("Foldl") {
+        CHECK(lz::chain(flattened).sum() == 15);
+        CHECK(flattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+    }
+
+    SECTION("From the middle") {
+        auto middle = std::next(flattened.begin(), 2);
+        CHECK(lz::chainRange(middle, flattened.end()).toVector() == std::vector<int>{ 3, 4, 5 });
+        CHECK(lz::chainRange(flattened.begin(), std::next(middle)).toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Any stops at the first match") {
+        std::size_t calls = 0;
+        CHECK(lz::chain(flattened).any([&calls](const int i) {
+            ++calls;
+            return i == 3;
+        }));
+        CHECK(calls == 3);
+    }
+
+    SECTION("By reference") {
+        lz::chain(flattened).forEach([](int& i) { i *= 2; });
+        CHECK(vecs[2][2][1] == 10);
+    }
+}
+
+TEST_CASE("Flatten is traversed one inner sequence at a time", "[Flatten][Basic functionality]") {
+    std::vector<std::vector<std::vector<int>>> vecs = { { { 1, 2 }, {} }, {}, { { 3 }, {}, { 4, 5 } } };
+    auto flattened = lz::flatten(vecs);
+
+    SECTION("Empty sequences are skipped") {
+        SegmentCounter counter;
+        CHECK(flattened.begin().segments(flattened.end(), counter));
+        CHECK(counter.count == 3);
+    }
+
+    SECTION("Partial sequences") {
+        SegmentCounter counter;
+        auto begin = std::next(flattened.begin());
+        CHECK(begin.segments(std::next(begin, 3), counter));
+        CHECK(counter.count == 3);
+        CHECK(lz::chainRange(begin, std::next(begin, 3)).toVector() == std::vector<int>{ 2, 3, 4 });
+    }
+
+    SECTION("Copy into a pointer") {
+        std::array<int, 5> copied{};
+        flattened.copyTo(copied.data());
+        CHECK(copied == std::array<int, 5>{ 1, 2, 3, 4, 5 });
+    }
+}
+
 TEST_CASE("Flatten binary operations", "[Flatten][Binary ops]") {
     std::vector<std::list<int>> nested = { { 1, 2, 3 }, {}, { 1 }, { 4, 5, 6 }, {} };
     auto flattened = lz::flatten(nested);
@@ -1,4 +1,5 @@
 #include <Lz/GroupBy.hpp>
+#include <Lz/Range.hpp>
 #include <catch2/catch.hpp>
 #include <list>
 
@@ -49,4 +50,97 @@ TEST_CASE("GroupBy binary operations", "[GroupBy][Binary ops]") {
         it = grouper.end();
         CHECK(it == grouper.end());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("GroupByAggregate", "[GroupBy][Aggregate]") {
+    struct Order {
+        int customerId;
+        int amount;
+    };
+    // Unsorted on purpose
+    std::vector<Order> orders = { { 3, 10 }, { 1, 5 }, { 3, 1 }, { 2, 7 }, { 1, 2 }, { 3, 4 } };
+    auto customerId = [](const Order& o) {
+        return o.customerId;
+    };
+    auto addAmount = [](int total, const Order& o) {
+        return total + o.amount;
+    };
+
+    SECTION("Groups in order of first appearance") {
+        auto totals = lz::groupByAggregate(orders, customerId, 0, addAmount);
+        std::vector<std::pair<int, int>> expected = { { 3, 15 }, { 1, 7 }, { 2, 7 } };
+        CHECK(totals.toVector() == expected);
+        CHECK(totals.distance() == 3);
+    }
+
+    SECTION("Counting") {
+        auto counts =
+            lz::groupByAggregate(orders, customerId, std::size_t{ 0 }, [](std::size_t n, const Order&) { return n + 1; });
+        auto it = counts.begin();
+        CHECK(it->first == 3);
+        CHECK(it->second == 3);
+        it += 2;
+        CHECK((*it).first == 2);
+        CHECK((*it).second == 1);
+        CHECK(++it == counts.end());
+    }
+
+    SECTION("Many keys") {
+        std::vector<int> values = lz::range(10000).toVector();
+        auto byRemainder = lz::groupByAggregate(
+            values, [](int i) { return i % 1000; }, 0LL, [](long long sum, int i) { return sum + i; });
+        CHECK(byRemainder.distance() == 1000);
+        long long expected = 0;
+        for (int i = 999; i < 10000; i += 1000) {
+            expected += i;
+        }
+        auto last = byRemainder.begin()[999];
+        CHECK(last.first == 999);
+        CHECK(last.second == expected);
+    }
+
+    SECTION("Empty") {
+        std::vector<Order> noOrders;
+        auto totals = lz::groupByAggregate(noOrders, customerId, 0, addAmount);
+        CHECK(totals.begin() == totals.end());
+    }
+}
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("GroupByAggregate parallel", "[GroupBy][Aggregate][Execution]") {
+    std::vector<int> values = lz::range(100000).toVector();
+    auto key = [](int i) {
+        return i % 37;
+    };
+    auto sum = [](long long total, int i) {
+        return total + i;
+    };
+    auto combine = [](long long a, long long b) {
+        return a + b;
+    };
+
+    auto sequential = lz::groupByAggregate(values, key, 0LL, sum);
+    auto parallel = lz::groupByAggregate(values, key, 0LL, sum, combine, std::execution::par);
+    CHECK(parallel.distance() == 37);
+    CHECK(parallel.toVector() == sequential.toVector());
+
+    SECTION("An init other than zero") {
+        // 1 is the identity of a product, so every part of a group may start from it
+        auto product = [](long long total, int i) {
+            return total * (i % 5 + 1) % 1000003;
+        };
+        auto multiply = [](long long a, long long b) {
+            return a * b % 1000003;
+        };
+        auto products = lz::groupByAggregate(values, key, 1LL, product, multiply, std::execution::par);
+        CHECK(products.toVector() == lz::groupByAggregate(values, key, 1LL, product).toVector());
+    }
+
+    SECTION("Sequential aggregation applies init once per group") {
+        std::vector<int> ones(1000, 1);
+        auto offsets = lz::groupByAggregate(ones, key, 100LL, sum, combine, std::execution::seq).toVector();
+        REQUIRE(offsets.size() == 1);
+        CHECK(offsets[0].second == 1100);
+    }
+}
+#endif // LZ_HAS_EXECUTION
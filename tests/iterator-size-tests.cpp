@@ -0,0 +1,129 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+using Vector = std::vector<int>;
+using Iterator = Vector::iterator;
+
+struct SmallPredicate {
+    bool operator()(const int i) const {
+        return i != 0;
+    }
+};
+
+// Large enough to be shared by the iterators of a view instead of copied into each of them
+struct LargePredicate {
+    int ignored[16]{};
+
+    bool operator()(const int i) const {
+        return i != ignored[0];
+    }
+};
+
+struct LargeCompare {
+    int ignored[16]{};
+
+    bool operator()(const int a, const int b) const {
+        return a + ignored[0] == b;
+    }
+};
+
+// Counts its copies, moves are not counted
+struct CountingPredicate {
+    int* copies;
+    int ignored[16]{};
+
+    explicit CountingPredicate(int* copyCount) : copies(copyCount) {
+    }
+
+    CountingPredicate(const CountingPredicate& other) : copies(other.copies) {
+        ++*copies;
+    }
+
+    CountingPredicate(CountingPredicate&&) = default;
+
+    bool operator()(const int i) const {
+        return i != ignored[0];
+    }
+};
+
+struct LargeMap {
+    std::vector<int> offsets{ 1 };
+
+    int operator()(const int i) const {
+        return i + offsets.front();
+    }
+};
+
+constexpr std::size_t Shared = sizeof(std::shared_ptr<const LargePredicate>);
+
+template<class View>
+using IterOf = decltype(std::declval<View&>().begin());
+
+using Filtered = decltype(lz::filter(std::declval<Vector&>(), LargePredicate{}));
+using Mapped = decltype(lz::map(std::declval<Filtered&>(), LargeMap{}));
+using Nested = decltype(lz::filter(std::declval<Mapped&>(), LargePredicate{}));
+} // namespace
+
+// Size report: the number of base iterators plus the size of the function storage of every adapter
+static_assert(sizeof(IterOf<Filtered>) <= 2 * sizeof(Iterator) + Shared, "filter: iterator, end and a shared predicate");
+static_assert(sizeof(IterOf<Mapped>) <= sizeof(IterOf<Filtered>) + Shared, "map: iterator and a shared function");
+// A filter of a map also keeps the (padded) result of the map it tested, so that the map is called once per element
+static_assert(sizeof(IterOf<Nested>) <= 2 * sizeof(IterOf<Mapped>) + Shared + sizeof(void*),
+              "nested filter: two inner iterators and the cached result of the map");
+static_assert(sizeof(IterOf<decltype(lz::filter(std::declval<Vector&>(), std::function<bool(int)>{}))>) <=
+                  2 * sizeof(Iterator) + Shared,
+              "filter with std::function: shared predicate");
+static_assert(sizeof(IterOf<decltype(lz::takeWhile(std::declval<Vector&>(), LargePredicate{}))>) <=
+                  2 * sizeof(Iterator) + Shared,
+              "takeWhile: iterator, end and a shared predicate");
+static_assert(sizeof(IterOf<decltype(lz::unique(std::declval<Vector&>(), LargeCompare{}))>) <= 2 * sizeof(Iterator) + Shared,
+              "unique: iterator, end and a shared comparer");
+static_assert(sizeof(IterOf<decltype(lz::groupBy(std::declval<Vector&>(), LargeCompare{}))>) <=
+                  3 * sizeof(Iterator) + Shared,
+              "groupBy: sub range, end and a shared comparer");
+// Small functions are cheaper to copy than to share
+static_assert(sizeof(IterOf<decltype(lz::filter(std::declval<Vector&>(), SmallPredicate{}))>) <= 3 * sizeof(Iterator),
+              "filter with an empty predicate: stored inline");
+
+TEST_CASE("Iterators share large functions", "[Iterator size][Basic functionality]") {
+    Vector vec = { 0, 1, 2, 3, 0, 4 };
+
+    SECTION("Nested pipeline") {
+        LargeMap map;
+        map.offsets = { 10 };
+        auto nested = lz::filter(lz::map(lz::filter(vec, LargePredicate{}), map), LargePredicate{});
+        auto begin = nested.begin();
+        auto copy = begin;
+        CHECK(*copy == 11);
+        CHECK(nested.toVector() == std::vector<int>{ 11, 12, 13, 14 });
+    }
+
+    SECTION("One function per view") {
+        int copies = 0;
+        auto filter = lz::filter(vec, CountingPredicate(&copies));
+        CHECK(copies == 0);
+        CHECK(&filter.begin().predicate() == &filter.end().predicate());
+        CHECK(filter.toVector() == std::vector<int>{ 1, 2, 3, 4 });
+        CHECK(copies == 0);
+
+        auto map = lz::map(vec, LargeMap{});
+        CHECK(&map.begin().function() == &map.end().function());
+    }
+
+    SECTION("std::function") {
+        std::function<bool(int)> predicate = [](const int i) {
+            return i % 2 == 0;
+        };
+        auto filter = lz::filter(vec, std::move(predicate));
+        auto it = filter.begin();
+        auto copy = it;
+        ++copy;
+        CHECK(*it == 0);
+        CHECK(*copy == 2);
+        CHECK(filter.toVector() == std::vector<int>{ 0, 2, 0, 4 });
+    }
+}
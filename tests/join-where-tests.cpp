@@ -1,5 +1,11 @@
+#include <Lz/Filter.hpp>
 #include <Lz/JoinWhere.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <algorithm>
+#include <atomic>
 #include <catch2/catch.hpp>
+#include <forward_list>
 #include <list>
 
 struct Customer {
@@ -163,4 +169,213 @@ TEST_CASE("JoinWhere to containers", "[JoinWhere][To container]") {
                    std::get<1>(a.second).customerId == std::get<1>(b.second).customerId;
         }));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Hash join", "[JoinWhere][Hash join]") {
+    std::vector<Customer> customers{
+        Customer{ 25 }, Customer{ 1 }, Customer{ 39 }, Customer{ 103 }, Customer{ 99 },
+    };
+    // Unsorted, with duplicate keys
+    std::list<PaymentBill> paymentBills{
+        PaymentBill{ 99, 1 }, PaymentBill{ 25, 0 },     PaymentBill{ 2523, 52 },
+        PaymentBill{ 25, 2 }, PaymentBill{ 2523, 53 }, PaymentBill{ 25, 3 },
+    };
+
+    auto joined = lz::hashJoinWhere(
+        customers, paymentBills, [](const Customer& p) { return p.id; }, [](const PaymentBill& c) { return c.customerId; },
+        [](const Customer& p, const PaymentBill& c) { return std::make_pair(p.id, c.id); });
+
+    SECTION("All matches in order") {
+        std::vector<std::pair<int, int>> expected = { { 25, 0 }, { 25, 2 }, { 25, 3 }, { 99, 1 } };
+        CHECK(joined.toVector() == expected);
+        CHECK(std::distance(joined.begin(), joined.end()) == 4);
+    }
+
+    SECTION("Copies share the table") {
+        auto copy = joined;
+        auto it = copy.begin();
+        CHECK(*it == std::make_pair(25, 0));
+        ++it;
+        CHECK(*it == std::make_pair(25, 2));
+        CHECK(it != copy.end());
+    }
+
+    SECTION("No matches") {
+        std::vector<Customer> noCustomers;
+        auto empty = lz::hashJoinWhere(
+            noCustomers, paymentBills, [](const Customer& p) { return p.id; },
+            [](const PaymentBill& c) { return c.customerId; }, [](const Customer& p, const PaymentBill&) { return p.id; });
+        CHECK(empty.begin() == empty.end());
+
+        std::vector<PaymentBill> noBills;
+        auto emptyTable = lz::hashJoinWhere(
+            customers, noBills, [](const Customer& p) { return p.id; }, [](const PaymentBill& c) { return c.customerId; },
+            [](const Customer& p, const PaymentBill&) { return p.id; });
+        CHECK(emptyTable.begin() == emptyTable.end());
+    }
+}
+
+TEST_CASE("Merge join", "[JoinWhere][Merge join]") {
+    // Both sorted, with duplicate keys on both sides
+    std::forward_list<Customer> customers{
+        Customer{ 1 }, Customer{ 25 }, Customer{ 25 }, Customer{ 39 }, Customer{ 99 }, Customer{ 103 },
+    };
+    std::vector<PaymentBill> paymentBills{
+        PaymentBill{ 25, 0 }, PaymentBill{ 25, 2 },    PaymentBill{ 99, 1 },
+        PaymentBill{ 100, 4 }, PaymentBill{ 2523, 52 }, PaymentBill{ 2523, 53 },
+    };
+
+    auto joined = lz::mergeJoinWhere(
+        customers, paymentBills, [](const Customer& p) { return p.id; }, [](const PaymentBill& c) { return c.customerId; },
+        [](const Customer& p, const PaymentBill& c) { return std::make_pair(p.id, c.id); });
+
+    SECTION("Many to many") {
+        std::vector<std::pair<int, int>> expected = { { 25, 0 }, { 25, 2 }, { 25, 0 }, { 25, 2 }, { 99, 1 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Operator== & operator!=") {
+        auto it = joined.begin();
+        CHECK(it != joined.end());
+        std::advance(it, 5);
+        CHECK(it == joined.end());
+    }
+
+    SECTION("Skewed inputs") {
+        std::vector<int> a = lz::range(1000).toVector();
+        std::vector<int> b = { -5, 0, 3, 3, 500, 999, 1000, 2000 };
+        auto identity = [](int i) {
+            return i;
+        };
+        auto merged = lz::mergeJoinWhere(a, b, identity, identity, [](int x, int y) { return std::make_pair(x, y); });
+        std::vector<std::pair<int, int>> expected = { { 0, 0 }, { 3, 3 }, { 3, 3 }, { 500, 500 }, { 999, 999 } };
+        CHECK(merged.toVector() == expected);
+    }
+
+    SECTION("Empty") {
+        std::vector<PaymentBill> noBills;
+        auto empty = lz::mergeJoinWhere(
+            customers, noBills, [](const Customer& p) { return p.id; }, [](const PaymentBill& c) { return c.customerId; },
+            [](const Customer& p, const PaymentBill&) { return p.id; });
+        CHECK(empty.begin() == empty.end());
+    }
+}
+
+TEST_CASE("Semi and anti join", "[JoinWhere][Semi join]") {
+    std::vector<Customer> customers{
+        Customer{ 25 }, Customer{ 1 }, Customer{ 39 }, Customer{ 103 }, Customer{ 99 },
+    };
+    // Unsorted, with duplicate keys
+    std::list<PaymentBill> paymentBills{
+        PaymentBill{ 99, 1 }, PaymentBill{ 25, 0 },     PaymentBill{ 2523, 52 },
+        PaymentBill{ 25, 2 }, PaymentBill{ 2523, 53 }, PaymentBill{ 25, 3 },
+    };
+    auto customerId = [](const Customer& c) {
+        return c.id;
+    };
+    auto billCustomerId = [](const PaymentBill& b) {
+        return b.customerId;
+    };
+
+    SECTION("Semi join returns every match once") {
+        auto joined = lz::semiJoin(customers, paymentBills, customerId, billCustomerId);
+        std::vector<int> expected = { 25, 99 };
+        CHECK(lz::map(joined, customerId).toVector() == expected);
+        CHECK(std::distance(joined.begin(), joined.end()) == 2);
+    }
+
+    SECTION("Anti join returns the complement") {
+        auto joined = lz::antiJoin(customers, paymentBills, customerId, billCustomerId);
+        std::vector<int> expected = { 1, 39, 103 };
+        CHECK(lz::map(joined, customerId).toVector() == expected);
+    }
+
+    SECTION("Empty") {
+        std::vector<PaymentBill> noBills;
+        auto semi = lz::semiJoin(customers, noBills, customerId, billCustomerId);
+        CHECK(semi.begin() == semi.end());
+        auto anti = lz::antiJoin(customers, noBills, customerId, billCustomerId);
+        CHECK(std::distance(anti.begin(), anti.end()) == 5);
+    }
+
+    SECTION("Filter statistics") {
+        std::vector<int> a = lz::range(10000).toVector();
+        std::vector<int> b = lz::range(0, 10000, 100).toVector();
+        auto identity = [](int i) {
+            return i;
+        };
+        auto semi = lz::semiJoin<true>(a, b, identity, identity, 0.01);
+        CHECK(semi.filterStats().probes == 1);
+
+        CHECK(std::distance(semi.begin(), semi.end()) == 100);
+        lz::SemiJoinStats stats = semi.filterStats();
+        CHECK(stats.matches() == 100);
+        // The first element is looked up when the view is created, the others while iterating
+        CHECK(stats.probes == 10000);
+        CHECK(stats.filterRejectRate() > 0.9);
+        CHECK(stats.falsePositiveRate() < 0.05);
+    }
+}
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("Parallel joins", "[JoinWhere][Execution]") {
+    std::vector<int> a = lz::range(2000).toVector();
+    std::vector<int> b;
+    for (int i = 0; i < 3000; i += 3) {
+        b.push_back(i);
+        b.push_back(i);
+    }
+    auto identity = [](int i) {
+        return i;
+    };
+    auto makePair = [](int x, int y) {
+        return std::make_pair(x, y);
+    };
+
+    std::vector<std::pair<int, int>> expected;
+    for (int i : a) {
+        if (i % 3 == 0) {
+            expected.emplace_back(i, i);
+            expected.emplace_back(i, i);
+        }
+    }
+
+    SECTION("Sorted join") {
+        auto joined = lz::joinWhere(a, b, identity, identity, makePair);
+        CHECK(joined.to<std::vector>(std::execution::par) == expected);
+    }
+
+    SECTION("Merge join") {
+        auto joined = lz::mergeJoinWhere(a, b, identity, identity, makePair);
+        CHECK(joined.to<std::vector>(std::execution::par) == expected);
+    }
+
+    SECTION("Semi join") {
+        auto joined = lz::semiJoin(a, b, identity, identity);
+        std::vector<int> expectedA = lz::filter(a, [](int i) { return i % 3 == 0; }).toVector();
+        CHECK(joined.to<std::vector>(std::execution::par) == expectedA);
+
+        // No probe is lost if the probes are done by several threads at once. The first element of every part is probed again
+        auto counted = lz::semiJoin<true>(a, b, identity, identity);
+        CHECK(counted.to<std::vector>(lz::execution::pool(4)) == expectedA);
+        CHECK(counted.filterStats().matches() >= expectedA.size());
+        CHECK(counted.filterStats().probes >= a.size());
+    }
+
+    SECTION("Hash join built in parallel") {
+        std::reverse(b.begin(), b.end());
+        auto joined = lz::hashJoinWhere(a, b, identity, identity, makePair, std::execution::par);
+        CHECK(joined.toVector() == expected);
+        CHECK(joined.to<std::vector>(std::execution::par) == expected);
+
+        // The keys are buffered while scattering, so every element of b is selected once
+        std::atomic<std::size_t> calls{ 0 };
+        auto countedIdentity = [&calls](int i) {
+            calls.fetch_add(1, std::memory_order_relaxed);
+            return i;
+        };
+        auto counted = lz::hashJoinWhere(a, b, identity, countedIdentity, makePair, lz::execution::pool(4));
+        CHECK(calls.load() == b.size());
+        CHECK(counted.toVector() == expected);
+    }
+}
+#endif // LZ_HAS_EXECUTION
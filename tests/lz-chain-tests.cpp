@@ -3,6 +3,10 @@
 #include <algorithm>
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <numeric>
 
 
 template class lz::IterView<decltype(std::declval<std::vector<int>&>().begin())>;
@@ -146,10 +150,20 @@ TEST_CASE("Iterator chaining") {
         CHECK(lz::chain(arr).except(arr2).distance() == 0);
     }
 
+    SECTION("HashExcept") {
+        CHECK(lz::chain(arr).hashExcept(arr2).distance() == 0);
+        CHECK(lz::chain(arr).hashExcept(arr2, lz::sorted).distance() == 0);
+    }
+
     SECTION("Unique") {
         CHECK(lz::chain(arr).unique().distance() == size);
     }
 
+    SECTION("Distinct") {
+        CHECK(lz::chain(arr).distinct().distance() == size);
+        CHECK(lz::chain(arr).distinctBy([](int i) { return i % 2; }).toVector() == std::vector<int>{ 0, 1 });
+    }
+
     SECTION("ChunkIf") {
         CHECK(lz::chain(arr).chunkIf([](int i) { return i % 2 == 0; }).distance() == 9);
     }
@@ -182,10 +196,46 @@ TEST_CASE("Iterator chaining") {
         CHECK(*++begin == std::make_tuple(1, 1));
     }
 
+    SECTION("HashJoinWhere") {
+        auto hashJoinWhere = lz::chain(arr).hashJoinWhere(
+            arr2, [](int a) { return a; }, [](int b) { return b; },
+            [](int a, int b) -> std::tuple<int, int> {
+                return std::tuple<int, int>{ a, b };
+            });
+        auto begin = hashJoinWhere.begin();
+        CHECK(*begin == std::make_tuple(0, 0));
+        CHECK(*++begin == std::make_tuple(1, 1));
+    }
+
+    SECTION("MergeJoinWhere") {
+        auto mergeJoinWhere = lz::chain(arr).mergeJoinWhere(
+            arr2, [](int a) { return a; }, [](int b) { return b; },
+            [](int a, int b) -> std::tuple<int, int> {
+                return std::tuple<int, int>{ a, b };
+            });
+        auto begin = mergeJoinWhere.begin();
+        CHECK(*begin == std::make_tuple(0, 0));
+        CHECK(*++begin == std::make_tuple(1, 1));
+    }
+
+    SECTION("SemiJoin") {
+        auto identity = [](int i) {
+            return i;
+        };
+        CHECK(lz::chain(arr).semiJoin(arr2, identity, identity).distance() == size);
+        CHECK(lz::chain(arr).antiJoin(arr2, identity, identity).distance() == 0);
+    }
+
     SECTION("Group by") {
         CHECK(lz::chain(arr).groupBy().distance() == size);
     }
 
+    SECTION("Group by aggregate") {
+        auto counts = lz::chain(arr).groupByAggregate([](int i) { return i % 2; }, 0, [](int n, int) { return n + 1; });
+        CHECK(counts.distance() == 2);
+        CHECK(counts.begin()->second + std::next(counts.begin())->second == static_cast<int>(size));
+    }
+
     SECTION("Find first[if]/last[if]") {
         CHECK(lz::chain(arr).findFirstOrDefault(16, 16) == 16);
         CHECK(lz::chain(arr).findFirstOrDefaultIf([](int i) { return i == 16; }, 16) == 16);
@@ -235,3 +285,185 @@ TEST_CASE("Iterator chaining") {
         CHECK(!lz::chain(arr).endsWith(std::array<int, 3>{ 13, 14, 16 }));
     }
 }
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("Parallel terminals over forward views", "[Chain][Execution]") {
+    std::vector<int> vec = lz::range(10000).toVector();
+    auto isEven = [](int i) {
+        return i % 2 == 0;
+    };
+    std::vector<int> expected;
+    std::copy_if(vec.begin(), vec.end(), std::back_inserter(expected), isEven);
+
+    SECTION("Filter") {
+        auto filter = lz::chain(vec).filter(isEven);
+        CHECK(filter.toVector(std::execution::par) == expected);
+        CHECK(filter.sum(std::execution::par) == std::accumulate(expected.begin(), expected.end(), 0));
+        CHECK(filter.all(isEven, std::execution::par));
+        CHECK(filter.any([](int i) { return i == 9998; }, std::execution::par));
+        CHECK(filter.none([](int i) { return i % 2 != 0; }, std::execution::par));
+
+        std::vector<int> copied;
+        filter.copyTo(std::back_inserter(copied), std::execution::par);
+        CHECK(copied == expected);
+
+        std::atomic<int> counter{ 0 };
+        filter.forEach([&counter](int) { ++counter; }, std::execution::par);
+        CHECK(counter == static_cast<int>(expected.size()));
+    }
+
+    SECTION("Filter map filter") {
+        auto view = lz::chain(vec).filter(isEven).map([](int i) { return i / 2; }).filter(isEven);
+        CHECK(view.toVector(std::execution::par) == view.toVector());
+    }
+
+    SECTION("Except") {
+        std::vector<int> toExcept = lz::range(0, 10000, 3).toVector();
+        auto except = lz::except(vec, toExcept);
+        CHECK(except.toVector(std::execution::par) == except.toVector());
+    }
+
+    SECTION("Hash except") {
+        std::vector<int> toExcept = lz::range(0, 10000, 3).toVector();
+        auto merged = lz::hashExcept(vec, toExcept, lz::sorted);
+        CHECK(merged.toVector(std::execution::par) == merged.toVector());
+        std::vector<int> unsorted(toExcept.rbegin(), toExcept.rend());
+        auto hashed = lz::hashExcept(vec, unsorted);
+        CHECK(hashed.toVector(std::execution::par) == merged.toVector());
+    }
+
+    SECTION("Unique") {
+        auto repeated = lz::chain(vec).map([](int i) { return i / 7; }).toVector();
+        auto unique = lz::unique(repeated);
+        CHECK(unique.toVector(std::execution::par) == lz::range(static_cast<int>(repeated.back()) + 1).toVector());
+    }
+
+    SECTION("Group by") {
+        auto repeated = lz::chain(vec).map([](int i) { return i / 7; }).toVector();
+        auto groupBy = lz::groupBy(repeated);
+        auto parallel = lz::map(groupBy, [](const auto& group) { return std::make_pair(group.first, group.second.distance()); });
+        CHECK(parallel.toVector(std::execution::par) == parallel.toVector());
+    }
+}
+#endif // LZ_HAS_EXECUTION
+
+TEST_CASE("Chaining fuses adjacent adapters") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    using Iterator = std::vector<int>::iterator;
+
+    SECTION("Map of map") {
+        auto mapped = lz::chain(vec).map([](int i) { return i * 2; }).map([](int i) { return i + 1; });
+        static_assert(std::is_same<decltype(mapped.begin().base()), const Iterator&>::value, "Maps should be fused");
+        CHECK(mapped.toVector() == std::vector<int>{ 3, 5, 7, 9, 11, 13, 15, 17 });
+    }
+
+    SECTION("Map followed by as") {
+        auto converted = lz::chain(vec).map([](int i) { return i * 2; }).as<double>();
+        static_assert(std::is_same<decltype(converted.begin().base()), const Iterator&>::value, "Map and as should be fused");
+        CHECK(converted.toVector() == std::vector<double>{ 2, 4, 6, 8, 10, 12, 14, 16 });
+    }
+
+    SECTION("Map of map by reference") {
+        lz::chain(vec).as<int&>().map([](int& i) -> int& { return i; }).forEach([](int& i) { i *= 10; });
+        CHECK(vec == std::vector<int>{ 10, 20, 30, 40, 50, 60, 70, 80 });
+    }
+
+    SECTION("Filter of filter") {
+        std::vector<int> calls;
+        auto filtered = lz::chain(vec)
+                            .filter([&calls](int i) {
+                                calls.push_back(i);
+                                return i % 2 == 0;
+                            })
+                            .filter([&calls](int i) {
+                                calls.push_back(-i);
+                                return i > 4;
+                            });
+        static_assert(std::is_same<decltype(filtered.begin().base()), const Iterator&>::value, "Filters should be fused");
+        CHECK(filtered.toVector() == std::vector<int>{ 6, 8 });
+        // The second predicate is only called for elements that pass the first one
+        CHECK(std::all_of(calls.begin(), calls.end(), [](int i) { return i > 0 || -i % 2 == 0; }));
+    }
+
+    SECTION("Filter of lz::pred filters") {
+        auto filtered = lz::chain(vec).filter(lz::pred::gt(2)).filter(lz::pred::lt(6));
+        static_assert(lz::pred::IsPredicate<typename std::decay<decltype(filtered.begin().predicate())>::type>::value,
+                      "Fused predicates from lz::pred should stay predicates from lz::pred");
+        CHECK(filtered.toVector() == std::vector<int>{ 3, 4, 5 });
+    }
+
+    SECTION("Take of take") {
+        auto taken = lz::chain(vec).take(6).take(3);
+        static_assert(std::is_same<decltype(taken.begin().base()), const Iterator&>::value, "Takes should be fused");
+        CHECK(taken.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(lz::chain(vec).take(3).take(6).toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Drop of drop") {
+        auto dropped = lz::chain(vec).drop(2).drop(3);
+        static_assert(std::is_same<decltype(dropped.begin()), Iterator>::value, "Drops should not nest");
+        CHECK(dropped.toVector() == std::vector<int>{ 6, 7, 8 });
+    }
+}
+
+TEST_CASE("Arithmetic views use vectorized kernels") {
+    std::vector<int> ints = lz::range(1000).toVector();
+    std::vector<double> doubles =
+        lz::chain(ints).map([](int i) { return static_cast<double>((i * 37) % 1000) - 500.; }).toVector();
+
+    SECTION("Sum and mean") {
+        CHECK(lz::chain(ints).sum() == 499500);
+        CHECK(lz::chain(doubles).sum() == Approx(std::accumulate(doubles.begin(), doubles.end(), 0.)));
+        CHECK(lz::chain(lz::as<double>(ints)).sum() == 499500.);
+        CHECK(lz::chain(ints).mean() == 499.5);
+        CHECK(lz::mean(std::vector<int>{ std::numeric_limits<int>::max(), std::numeric_limits<int>::max() }) ==
+              static_cast<double>(std::numeric_limits<int>::max()));
+        std::vector<int> empty;
+        CHECK(lz::chain(empty).sum() == 0);
+    }
+
+    SECTION("Count") {
+        CHECK(lz::chain(ints).count(42) == 1);
+        CHECK(lz::chain(doubles).count(-500) == 1);
+        CHECK(lz::chain(ints).count(42.5) == 0);
+        std::vector<unsigned> unsignedInts(5, 7u);
+        CHECK(lz::chain(unsignedInts).count(7u) == 5);
+        CHECK(lz::chain(lz::as<long long>(unsignedInts)).count(7) == 5);
+    }
+
+    SECTION("Min and max return the first of equal elements") {
+        std::vector<int> repeated(100, 3);
+        repeated[50] = 1;
+        repeated[70] = 1;
+        repeated[10] = 5;
+        repeated[90] = 5;
+        auto view = lz::chain(repeated);
+        CHECK(&view.min() == &repeated[50]);
+        CHECK(&view.max() == &repeated[10]);
+        auto minMax = view.minMax();
+        CHECK(&minMax.first == &repeated[50]);
+        CHECK(&minMax.second == &repeated[10]);
+        CHECK(lz::chain(doubles).min() == -500.);
+        CHECK(lz::chain(doubles).max() == 499.);
+        CHECK(lz::chain(lz::as<long long>(ints)).minMax() == std::make_pair(0LL, 999LL));
+    }
+
+    SECTION("NaN") {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<double> withNan = { 2., nan, 1., 3. };
+        CHECK(lz::chain(withNan).min() == 1.);
+        CHECK(lz::chain(withNan).max() == 3.);
+        withNan[0] = nan;
+        CHECK(std::isnan(lz::chain(withNan).min()));
+        CHECK(&lz::chain(withNan).max() == &withNan[0]);
+    }
+
+    SECTION("Other comparers and sequences") {
+        CHECK(lz::chain(doubles).max(std::greater<double>()) == -500.);
+        std::list<int> list(ints.begin(), ints.end());
+        auto minMax = lz::chain(list).minMax(std::greater<int>());
+        CHECK(minMax.first == 999);
+        CHECK(minMax.second == 0);
+        CHECK(lz::chain(list).sum() == 499500);
+    }
+}
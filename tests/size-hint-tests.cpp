@@ -0,0 +1,122 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <functional>
+#include <list>
+
+namespace {
+template<class Iterable>
+lz::detail::SizeHint sizeHintOf(const Iterable& iterable) {
+    return lz::detail::getSizeHint(std::begin(iterable), std::end(iterable));
+}
+} // namespace
+
+TEST_CASE("Exact size hints", "[Size hint][Exact]") {
+    std::list<int> list = { 1, 2, 3, 4, 5, 6, 7 };
+    std::vector<int> vec = { 1, 2, 3 };
+
+    SECTION("Std containers") {
+        CHECK(sizeHintOf(vec).isExact());
+        CHECK(sizeHintOf(vec).size == 3);
+        CHECK(!sizeHintOf(list).isKnown());
+    }
+
+    SECTION("Take of a list") {
+        auto take = lz::take(list.begin(), 4);
+        CHECK(sizeHintOf(take).isExact());
+        CHECK(sizeHintOf(take).size == 4);
+    }
+
+    SECTION("Chunks, concatenate and zip") {
+        auto chunks = lz::chunks(vec, 2);
+        CHECK(sizeHintOf(chunks).size == 2);
+        std::vector<int> vec2 = { 4, 5 };
+        auto concat = lz::concat(vec, vec2);
+        CHECK(sizeHintOf(concat).size == 5);
+        auto zip = lz::zip(lz::take(list.begin(), 5), vec);
+        CHECK(sizeHintOf(zip).isExact());
+        CHECK(sizeHintOf(zip).size == 3);
+        auto zipLongest = lz::zipLongest(lz::take(list.begin(), 5), vec);
+        CHECK(sizeHintOf(zipLongest).size == 5);
+    }
+
+    SECTION("Generators") {
+        CHECK(sizeHintOf(lz::repeat(1, 10)).size == 10);
+        CHECK(sizeHintOf(lz::generate([]() { return 1; }, 10)).size == 10);
+        CHECK(!sizeHintOf(lz::generate([]() { return 1; })).isKnown());
+        CHECK(!sizeHintOf(lz::repeat(1)).isKnown());
+    }
+
+    SECTION("Cartesian product, join, exclude and take every") {
+        std::vector<char> chars = { 'a', 'b' };
+        auto cartesian = lz::cartesian(vec, chars);
+        CHECK(sizeHintOf(cartesian).size == 6);
+        auto join = lz::join(lz::take(list.begin(), 3), ", ");
+        CHECK(sizeHintOf(join).size == 5);
+        auto exclude = lz::exclude(vec, 1, 2);
+        CHECK(sizeHintOf(exclude).isExact());
+        CHECK(sizeHintOf(exclude).size == 2);
+        auto takeEvery = lz::takeEvery(lz::take(list.begin(), 7), 3);
+        CHECK(sizeHintOf(takeEvery).size == 3);
+    }
+}
+
+TEST_CASE("Upper bound size hints", "[Size hint][Upper bound]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    auto isEven = [](int i) {
+        return i % 2 == 0;
+    };
+
+    auto filter = lz::filter(vec, isEven);
+    CHECK(sizeHintOf(filter).bound == lz::detail::SizeBound::upper);
+    // begin() already skipped the first odd number
+    CHECK(sizeHintOf(filter).size == 4);
+
+    auto takeWhile = lz::takeWhile(vec, [](int i) { return i < 3; });
+    CHECK(sizeHintOf(takeWhile).bound == lz::detail::SizeBound::upper);
+    CHECK(static_cast<std::size_t>(takeWhile.distance()) <= sizeHintOf(takeWhile).size);
+
+    std::forward_list<int> fwdList = { 1, 2 };
+    CHECK(!sizeHintOf(lz::filter(fwdList, isEven)).isKnown());
+
+    // A range of unknown size may be shorter than the other one
+    std::vector<int> large(1000);
+    // std::function, because lambdas are not default constructible pre C++20
+    std::function<std::pair<bool, int>(int&)> generator = [](int& i) {
+        const int copy = i++;
+        return std::make_pair(copy != 2, copy);
+    };
+    auto twoElements = lz::generateWhile(generator, 0);
+    auto zip = lz::zip(large, twoElements);
+    CHECK(sizeHintOf(zip).bound == lz::detail::SizeBound::upper);
+    CHECK(sizeHintOf(zip).size == 1000);
+    auto zipped = zip.toVector();
+    CHECK(zipped.size() == 2);
+    CHECK(zipped.capacity() < 1000);
+}
+
+TEST_CASE("Materializing reserves once", "[Size hint][To container]") {
+    std::list<int> list = { 1, 2, 3, 4, 5, 6, 7 };
+
+    std::vector<int> take = lz::take(list.begin(), 5).toVector();
+    CHECK(take.capacity() == 5);
+
+    std::vector<int> concat = lz::concat(lz::take(list.begin(), 2), lz::take(list.begin(), 3)).toVector();
+    CHECK(concat.capacity() == 5);
+
+    std::string str = lz::repeat('a', 3).toString();
+    CHECK(str == "aaa");
+}
+
+TEST_CASE("Materializing does not reserve upper bounds", "[Size hint][To container]") {
+    std::vector<int> vec(100000);
+    vec[500] = 1;
+    auto sparse = lz::filter(vec, [](int i) { return i == 1; });
+    REQUIRE(sizeHintOf(sparse).bound == lz::detail::SizeBound::upper);
+
+    std::vector<int> filtered = sparse.toVector();
+    CHECK(filtered == std::vector<int>{ 1 });
+    CHECK(filtered.capacity() < 100);
+    CHECK(sparse.toString(",") == "1");
+    CHECK(sparse.toUnorderedMap([](int i) { return i; }).bucket_count() < 100);
+}
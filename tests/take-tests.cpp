@@ -1,5 +1,6 @@
 #include <Lz/Take.hpp>
 #include <catch2/catch.hpp>
+#include <deque>
 #include <list>
 
 TEST_CASE("Take changing and creating elements", "[Take][Basic functionality]") {
@@ -88,6 +89,14 @@ TEST_CASE("Take to containers", "[Take][To container]") {
         REQUIRE(std::equal(lst.begin(), lst.end(), takeEvery.begin()));
     }
 
+    SECTION("Of a contiguous sequence") {
+        std::vector<int> vec(array.begin(), array.end());
+        auto take = lz::take(vec, 3);
+        CHECK(take.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(take.to<std::deque>() == std::deque<int>{ 1, 2, 3 });
+        CHECK(lz::take(vec, 0).toVector().empty());
+    }
+
     SECTION("To map") {
         auto map = takeEvery.toMap([](int i) { return i; });
         REQUIRE(map.size() == 4);
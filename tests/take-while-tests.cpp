@@ -40,6 +40,21 @@ TEST_CASE("Drop while takes elements and is by reference", "[TakeWhile][Basic fu
     }
 }
 
+TEST_CASE("Drop while searches the first element only once", "[TakeWhile][Basic functionality]") {
+    std::array<int, 5> array{ 1, 2, 3, 4, 5 };
+    std::size_t calls = 0;
+    auto dropWhile = lz::dropWhile(array, [&calls](int element) {
+        ++calls;
+        return element < 4;
+    });
+    CHECK(calls == 4);
+
+    for (int i = 0; i < 10; ++i) {
+        CHECK(*dropWhile.begin() == 4);
+    }
+    CHECK(calls == 4);
+}
+
 TEST_CASE("TakeWhile binary operations", "[TakeWhile][Binary ops]") {
     constexpr size_t size = 10;
     std::array<int, size> array{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };